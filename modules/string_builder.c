@@ -1,6 +1,5 @@
 #include "string_builder.h"
 #include <string.h>
-#include <stdio.h>
 
 
 bool sb_init(string_builder_t *sb, const char *s, const size_t size) {
@@ -70,28 +69,157 @@ bool sb_append_char_array_at(string_builder_t *sb, const size_t position, const
     return bRet;
 }
 
-bool sb_append_int(string_builder_t *sb, int val) {
-    bool bRet = false;
+static const char sb_digit_pairs[201] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+static const char sb_hex_digits[16] = "0123456789abcdef";
+
+static size_t sb_dec_digits(uint64_t val) {
+    size_t n = 1;
+    for (uint64_t pow10 = 10; val >= pow10; pow10 *= 10) {
+        n++;
+        if (n == 20) break;     // 10^20 overflows uint64_t
+    }
+    return n;
+}
+
+static size_t sb_hex_ndigits(uint64_t val) {
+    size_t n = 1;
+    while (val >>= 4) {
+        n++;
+    }
+    return n;
+}
 
-    if (sb) {
-        char val_str[16];
-        const uint8_t len = sprintf(val_str, "%d", val);
-        bRet = sb_append_char_array(sb, val_str, len);
+/**
+ * @brief write the decimal digits of val backwards, ending right before end
+ */
+static void sb_write_dec(char *end, uint64_t val) {
+    // 64-bit divisions only while the value does not fit in 32 bits (slow on 32-bit targets)
+    while (val > UINT32_MAX) {
+        const uint64_t q = val / 100;
+        const uint32_t pair = (uint32_t) (val - q * 100) * 2;
+        *--end = sb_digit_pairs[pair + 1];
+        *--end = sb_digit_pairs[pair];
+        val = q;
     }
 
-    return bRet;
+    uint32_t v = (uint32_t) val;
+    while (v >= 100) {
+        const uint32_t q = v / 100;
+        const uint32_t pair = (v - q * 100) * 2;
+        *--end = sb_digit_pairs[pair + 1];
+        *--end = sb_digit_pairs[pair];
+        v = q;
+    }
+    if (v >= 10) {
+        *--end = sb_digit_pairs[v * 2 + 1];
+        *--end = sb_digit_pairs[v * 2];
+    } else {
+        *--end = (char) ('0' + v);
+    }
 }
 
-bool sb_append_long_long(string_builder_t *sb, long long val) {
-    bool bRet = false;
+static void sb_write_hex(char *end, uint64_t val, size_t ndigits) {
+    while (ndigits--) {
+        *--end = sb_hex_digits[val & 0xF];
+        val >>= 4;
+    }
+}
+
+static void sb_append_fill(string_builder_t *sb, char c, size_t len) {
+    const size_t n = sb_get_nbytes2copy(sb, len);
+    memset(sb->s + sb->len, c, n);
+    sb->len += n;
+}
 
-    if (sb) {
-        char val_str[16];
-        const uint8_t len = sprintf(val_str, "%ll", val);
-        bRet = sb_append_char_array(sb, val_str, len);
+/**
+ * @brief append [-][zero padding]digits, written in place when the whole number fits
+ */
+static bool sb_append_number(string_builder_t *sb, uint64_t magnitude, bool negative, bool hex, size_t width) {
+    if (!sb || !sb_get_remainning_bytes(sb)) return false;
+
+    const size_t ndigits = hex ? sb_hex_ndigits(magnitude) : sb_dec_digits(magnitude);
+    const size_t sign = negative ? 1 : 0;
+    const size_t pad = width > sign + ndigits ? width - sign - ndigits : 0;
+    const size_t total = sign + pad + ndigits;
+
+    if (total <= sb_get_remainning_bytes(sb)) {
+        char *p = sb->s + sb->len;
+        if (negative) *p++ = '-';
+        memset(p, '0', pad);
+        p += pad;
+        if (hex) {
+            sb_write_hex(p + ndigits, magnitude, ndigits);
+        } else {
+            sb_write_dec(p + ndigits, magnitude);
+        }
+        sb->len += total;
+    } else {
+        // truncated: format the digits aside and keep what fits
+        char digits[20];
+        if (hex) {
+            sb_write_hex(digits + ndigits, magnitude, ndigits);
+        } else {
+            sb_write_dec(digits + ndigits, magnitude);
+        }
+        if (negative) sb_append_fill(sb, '-', 1);
+        sb_append_fill(sb, '0', pad);
+        const size_t n = sb_get_nbytes2copy(sb, ndigits);
+        memcpy(sb->s + sb->len, digits, n);
+        sb->len += n;
     }
+    sb->s[sb->len] = 0;
+    return true;
+}
 
-    return bRet;
+static uint64_t sb_magnitude(int64_t val) {
+    return val < 0 ? 0 - (uint64_t) val : (uint64_t) val;
+}
+
+bool sb_append_int(string_builder_t *sb, int val) {
+    return sb_append_int64(sb, val);
+}
+
+bool sb_append_long_long(string_builder_t *sb, long long val) {
+    return sb_append_int64(sb, (int64_t) val);
+}
+
+bool sb_append_int32(string_builder_t *sb, int32_t val) {
+    return sb_append_number(sb, sb_magnitude(val), val < 0, false, 0);
+}
+
+bool sb_append_uint32(string_builder_t *sb, uint32_t val) {
+    return sb_append_number(sb, val, false, false, 0);
+}
+
+bool sb_append_int64(string_builder_t *sb, int64_t val) {
+    return sb_append_number(sb, sb_magnitude(val), val < 0, false, 0);
+}
+
+bool sb_append_uint64(string_builder_t *sb, uint64_t val) {
+    return sb_append_number(sb, val, false, false, 0);
+}
+
+bool sb_append_int64_pad(string_builder_t *sb, int64_t val, size_t width) {
+    return sb_append_number(sb, sb_magnitude(val), val < 0, false, width);
+}
+
+bool sb_append_uint64_pad(string_builder_t *sb, uint64_t val, size_t width) {
+    return sb_append_number(sb, val, false, false, width);
+}
+
+bool sb_append_hex(string_builder_t *sb, uint64_t val, size_t width) {
+    return sb_append_number(sb, val, false, true, width);
 }
 
 bool sb_append_byte(string_builder_t *sb, uint8_t val) {
@@ -27,6 +27,29 @@ bool sb_append_int(string_builder_t *sb, int val);
 
 bool sb_append_long_long(string_builder_t *sb, long long val);
 
+/*
+ * Integer formatting without sprintf: the digits are written straight into the buffer (two at
+ * a time from a digit-pair table). 8 and 16-bit values go through the 32-bit calls. Like
+ * sb_append_char_array, a number that does not fit is truncated and false is returned only
+ * when nothing could be appended.
+ */
+bool sb_append_int32(string_builder_t *sb, int32_t val);
+
+bool sb_append_uint32(string_builder_t *sb, uint32_t val);
+
+bool sb_append_int64(string_builder_t *sb, int64_t val);
+
+bool sb_append_uint64(string_builder_t *sb, uint64_t val);
+
+/* zero-padded to at least width characters, sign included (printf "%0*lld") */
+bool sb_append_int64_pad(string_builder_t *sb, int64_t val, size_t width);
+
+/* zero-padded to at least width characters (printf "%0*llu") */
+bool sb_append_uint64_pad(string_builder_t *sb, uint64_t val, size_t width);
+
+/* lowercase hex without prefix, zero-padded to at least width digits (printf "%0*llx") */
+bool sb_append_hex(string_builder_t *sb, uint64_t val, size_t width);
+
 bool sb_append_byte(string_builder_t *sb, uint8_t val);
 
 #endif //__STRING_BUILDER_H__
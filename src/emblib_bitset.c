@@ -0,0 +1,115 @@
+#include "emblib_bitset.h"
+#include "emblib_util.h"
+#include <string.h>
+
+#define WORD_INDEX(key) ((key) >> 5)
+#define WORD_BIT(key)   ((uint32_t) 1u << ((key) & 31u))
+
+bool emblib_bitset_init(emblib_bitset_t *bitset, void *array, size_t buffer_len, size_t nbits) {
+    if (!bitset || !array || !nbits || buffer_len < EMBLIB_BITSET_WORDS(nbits) * sizeof(uint32_t)) return false;
+
+    *bitset = (emblib_bitset_t) {
+            .words  = (uint32_t *) array,
+            .nwords = EMBLIB_BITSET_WORDS(nbits),
+            .nbits  = nbits
+    };
+    emblib_bitset_flush(bitset);
+    return true;
+}
+
+bool emblib_bitset_add(emblib_bitset_t *bitset, size_t key) {
+    if (!bitset || key >= bitset->nbits) return false;
+
+    uint32_t *word = &bitset->words[WORD_INDEX(key)];
+    if (*word & WORD_BIT(key)) return false;
+
+    *word |= WORD_BIT(key);
+    return true;
+}
+
+bool emblib_bitset_remove(emblib_bitset_t *bitset, size_t key) {
+    if (!bitset || key >= bitset->nbits) return false;
+
+    uint32_t *word = &bitset->words[WORD_INDEX(key)];
+    if (!(*word & WORD_BIT(key))) return false;
+
+    *word &= ~WORD_BIT(key);
+    return true;
+}
+
+bool emblib_bitset_contains(emblib_bitset_t *bitset, size_t key) {
+    return (bitset && key < bitset->nbits) ? (bitset->words[WORD_INDEX(key)] & WORD_BIT(key)) != 0 : false;
+}
+
+size_t emblib_bitset_next(emblib_bitset_t *bitset, size_t from) {
+    if (!bitset) return 0;
+    if (from >= bitset->nbits) return bitset->nbits;
+
+    size_t index = WORD_INDEX(from);
+    // drop the bits below from in the first word
+    uint32_t word = bitset->words[index] & ~(WORD_BIT(from) - 1u);
+
+    while (!word) {
+        if (++index == bitset->nwords) return bitset->nbits;
+        word = bitset->words[index];
+    }
+    return index * 32 + emblib_ctz32(word);
+}
+
+static bool bitset_compatible(emblib_bitset_t *dst, emblib_bitset_t *src) {
+    return dst && src && dst->nbits == src->nbits;
+}
+
+bool emblib_bitset_union(emblib_bitset_t *dst, emblib_bitset_t *src) {
+    if (!bitset_compatible(dst, src)) return false;
+
+    for (size_t i = 0; i < dst->nwords; i++) {
+        dst->words[i] |= src->words[i];
+    }
+    return true;
+}
+
+bool emblib_bitset_intersect(emblib_bitset_t *dst, emblib_bitset_t *src) {
+    if (!bitset_compatible(dst, src)) return false;
+
+    for (size_t i = 0; i < dst->nwords; i++) {
+        dst->words[i] &= src->words[i];
+    }
+    return true;
+}
+
+bool emblib_bitset_difference(emblib_bitset_t *dst, emblib_bitset_t *src) {
+    if (!bitset_compatible(dst, src)) return false;
+
+    for (size_t i = 0; i < dst->nwords; i++) {
+        dst->words[i] &= ~src->words[i];
+    }
+    return true;
+}
+
+size_t emblib_bitset_count(emblib_bitset_t *bitset) {
+    size_t count = 0;
+    for (size_t i = 0; bitset && i < bitset->nwords; i++) {
+        count += emblib_popcount32(bitset->words[i]);
+    }
+    return count;
+}
+
+size_t emblib_bitset_size(emblib_bitset_t *bitset) {
+    return bitset ? bitset->nbits : 0;
+}
+
+void emblib_bitset_flush(emblib_bitset_t *bitset) {
+    if (bitset) {
+        memset(bitset->words, 0, bitset->nwords * sizeof(uint32_t));
+    }
+}
+
+bool emblib_bitset_is_empty(emblib_bitset_t *bitset) {
+    if (!bitset) return false;
+
+    for (size_t i = 0; i < bitset->nwords; i++) {
+        if (bitset->words[i]) return false;
+    }
+    return true;
+}
@@ -0,0 +1,119 @@
+#ifndef __EMBLIB_BITSET_H__
+#define __EMBLIB_BITSET_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+//! number of 32-bit words needed for a bitset of nbits keys
+#define EMBLIB_BITSET_WORDS(nbits) (((nbits) + 31) / 32)
+
+/**
+ * @brief Set of integer keys in [0, nbits), one bit per key, stored in a caller array of 32-bit words.
+ */
+typedef struct _emblib_bitset_t {
+    uint32_t *words;    //!< bit array
+    size_t nwords;      //!< number of words used
+    size_t nbits;       //!< number of keys of the domain
+} emblib_bitset_t;
+
+/**
+ * @brief Initializes an empty bitset.
+ *
+ * @param[in,out] bitset Pointer to the bitset structure.
+ * @param[in] array Pointer to the memory where the bits will be stored (uint32_t aligned).
+ * @param[in] buffer_len Size in bytes of array, at least EMBLIB_BITSET_WORDS(nbits) * 4.
+ * @param[in] nbits Number of keys of the domain [0, nbits).
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_bitset_init(emblib_bitset_t *bitset, void *array, size_t buffer_len, size_t nbits);
+
+/**
+ * @brief Adds a key to the bitset. O(1).
+ *
+ * @param[in,out] bitset Pointer to the bitset structure.
+ * @param[in] key Key to be added.
+ * @return true if the add is successful, false if the key already exists or is out of range.
+ */
+bool emblib_bitset_add(emblib_bitset_t *bitset, size_t key);
+
+/**
+ * @brief Removes a key from the bitset. O(1).
+ *
+ * @param[in,out] bitset Pointer to the bitset structure.
+ * @param[in] key Key to be removed.
+ * @return true if the remove is successful, false otherwise.
+ */
+bool emblib_bitset_remove(emblib_bitset_t *bitset, size_t key);
+
+/**
+ * @brief Checks if the bitset contains a key. O(1).
+ *
+ * @param[in] bitset Pointer to the bitset structure.
+ * @param[in] key Key to check.
+ * @return true if the bitset contains the key, false otherwise.
+ */
+bool emblib_bitset_contains(emblib_bitset_t *bitset, size_t key);
+
+/**
+ * @brief Finds the first key of the bitset not lower than from.
+ *
+ * @param[in] bitset Pointer to the bitset structure.
+ * @param[in] from First key to look at.
+ * @return the key found, emblib_bitset_size() if there is none.
+ */
+size_t emblib_bitset_next(emblib_bitset_t *bitset, size_t from);
+
+/**
+ * @brief dst = dst | src. Both bitsets must have the same size.
+ *
+ * @param[in,out] dst Pointer to the destination bitset.
+ * @param[in] src Pointer to the source bitset.
+ * @return true on success, false on incompatible bitsets.
+ */
+bool emblib_bitset_union(emblib_bitset_t *dst, emblib_bitset_t *src);
+
+/**
+ * @brief dst = dst & src. Both bitsets must have the same size.
+ *
+ * @param[in,out] dst Pointer to the destination bitset.
+ * @param[in] src Pointer to the source bitset.
+ * @return true on success, false on incompatible bitsets.
+ */
+bool emblib_bitset_intersect(emblib_bitset_t *dst, emblib_bitset_t *src);
+
+/**
+ * @brief dst = dst & ~src. Both bitsets must have the same size.
+ *
+ * @param[in,out] dst Pointer to the destination bitset.
+ * @param[in] src Pointer to the source bitset.
+ * @return true on success, false on incompatible bitsets.
+ */
+bool emblib_bitset_difference(emblib_bitset_t *dst, emblib_bitset_t *src);
+
+/**
+ * @brief Returns the number of keys stored in the bitset (popcount of the words).
+ *
+ * @param[in] bitset Pointer to the bitset structure.
+ * @return Number of keys in the bitset.
+ */
+size_t emblib_bitset_count(emblib_bitset_t *bitset);
+
+/**
+ * @brief Returns the size of the key domain.
+ *
+ * @param[in] bitset Pointer to the bitset structure.
+ * @return nbits.
+ */
+size_t emblib_bitset_size(emblib_bitset_t *bitset);
+
+/**
+ * @brief Clears all keys from the bitset.
+ *
+ * @param[in,out] bitset Pointer to the bitset structure.
+ */
+void emblib_bitset_flush(emblib_bitset_t *bitset);
+
+bool emblib_bitset_is_empty(emblib_bitset_t *bitset);
+
+#endif //__EMBLIB_BITSET_H__
@@ -0,0 +1,68 @@
+#include "emblib_bloom.h"
+
+/**
+ * @brief position of the i-th bit: (h1 + i * h2) mapped onto [0, nbits) with a multiply instead of a modulo
+ */
+static size_t bloom_bit(emblib_bloom_t *bloom, uint64_t hash, uint32_t i) {
+    const uint32_t h1 = (uint32_t) hash;
+    const uint32_t h2 = (uint32_t) (hash >> 32) | 1u;
+    return (size_t) (((uint64_t) (uint32_t) (h1 + i * h2) * bloom->bits.nbits) >> 32);
+}
+
+bool emblib_bloom_init(emblib_bloom_t *bloom, void *array, size_t buffer_len, uint32_t num_hashes,
+                       uint64_t (*hash_fn)(void *data)) {
+    if (!bloom || !hash_fn || !num_hashes) return false;
+
+    const uint64_t nbits = (uint64_t) (buffer_len / sizeof(uint32_t)) * 32;
+    if (nbits > UINT32_MAX) return false;
+    if (!emblib_bitset_init(&bloom->bits, array, buffer_len, (size_t) nbits)) return false;
+
+    bloom->num_hashes = num_hashes;
+    bloom->hash_fn = hash_fn;
+    return true;
+}
+
+uint32_t emblib_bloom_hashes_for(double fp_rate) {
+    if (!(fp_rate > 0.0 && fp_rate < 1.0)) return 0;
+
+    uint32_t k = 0;
+    for (double x = 1.0 / fp_rate; x > 1.0; x /= 2.0) {
+        k++;
+    }
+    return k;
+}
+
+size_t emblib_bloom_size_for(size_t expected, double fp_rate) {
+    const uint32_t k = emblib_bloom_hashes_for(fp_rate);
+    if (!k || !expected) return 0;
+
+    // m = n * k / ln(2)
+    const double bits = (double) expected * k * 1.4426950408889634;
+    const size_t words = (size_t) (bits / 32.0) + 1;
+    return words * sizeof(uint32_t);
+}
+
+void emblib_bloom_add(emblib_bloom_t *bloom, void *data) {
+    if (!bloom || !data) return;
+
+    const uint64_t hash = bloom->hash_fn(data);
+    for (uint32_t i = 0; i < bloom->num_hashes; i++) {
+        emblib_bitset_add(&bloom->bits, bloom_bit(bloom, hash, i));
+    }
+}
+
+bool emblib_bloom_maybe_contains(emblib_bloom_t *bloom, void *data) {
+    if (!bloom || !data) return false;
+
+    const uint64_t hash = bloom->hash_fn(data);
+    for (uint32_t i = 0; i < bloom->num_hashes; i++) {
+        if (!emblib_bitset_contains(&bloom->bits, bloom_bit(bloom, hash, i))) return false;
+    }
+    return true;
+}
+
+void emblib_bloom_flush(emblib_bloom_t *bloom) {
+    if (bloom) {
+        emblib_bitset_flush(&bloom->bits);
+    }
+}
@@ -0,0 +1,74 @@
+#ifndef __EMBLIB_BLOOM_H__
+#define __EMBLIB_BLOOM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "emblib_bitset.h"
+
+/**
+ * @brief Bloom filter over a caller buffer. The k bit positions of an element are derived
+ *        from one 64-bit hash (double hashing), so hash_fn is called once per operation.
+ */
+typedef struct _emblib_bloom_t {
+    emblib_bitset_t bits;               //!< filter bits
+    uint32_t num_hashes;                //!< bits set per element (k)
+    uint64_t (*hash_fn)(void *data);    //! hash function
+} emblib_bloom_t;
+
+/**
+ * @brief Initializes an empty bloom filter.
+ *
+ * @param[in,out] bloom Pointer to the bloom filter structure.
+ * @param[in] array Pointer to the memory of the filter (uint32_t aligned), see emblib_bloom_size_for.
+ * @param[in] buffer_len Size in bytes of array.
+ * @param[in] num_hashes Bits set per element, see emblib_bloom_hashes_for.
+ * @param[in] hash_fn Hash function.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_bloom_init(emblib_bloom_t *bloom, void *array, size_t buffer_len, uint32_t num_hashes,
+                       uint64_t (*hash_fn)(void *data));
+
+/**
+ * @brief Number of hash functions (bits set per element) giving a false-positive rate
+ *        (ceil(log2(1 / fp_rate))).
+ *
+ * @param[in] fp_rate Target false-positive rate, in (0, 1).
+ * @return number of hashes, 0 for an invalid rate.
+ */
+uint32_t emblib_bloom_hashes_for(double fp_rate);
+
+/**
+ * @brief Filter size in bytes for expected elements at a false-positive rate.
+ *
+ * @param[in] expected Number of elements expected in the filter.
+ * @param[in] fp_rate Target false-positive rate, in (0, 1).
+ * @return size in bytes (multiple of 4), 0 for invalid parameters.
+ */
+size_t emblib_bloom_size_for(size_t expected, double fp_rate);
+
+/**
+ * @brief Adds an element to the filter.
+ *
+ * @param[in,out] bloom Pointer to the bloom filter structure.
+ * @param[in] data Pointer to the element.
+ */
+void emblib_bloom_add(emblib_bloom_t *bloom, void *data);
+
+/**
+ * @brief Checks an element against the filter.
+ *
+ * @param[in] bloom Pointer to the bloom filter structure.
+ * @param[in] data Pointer to the element.
+ * @return false if the element was never added, true if it may have been added.
+ */
+bool emblib_bloom_maybe_contains(emblib_bloom_t *bloom, void *data);
+
+/**
+ * @brief Clears the filter.
+ *
+ * @param[in,out] bloom Pointer to the bloom filter structure.
+ */
+void emblib_bloom_flush(emblib_bloom_t *bloom);
+
+#endif //__EMBLIB_BLOOM_H__
@@ -0,0 +1,137 @@
+#include "emblib_concurrent_set.h"
+#include <string.h>
+
+static emblib_concurrent_set_stripe_t *concurrent_set_stripe(emblib_concurrent_set_t *set, uint64_t hash) {
+    // the low bits index the slots inside the stripe
+    return &set->stripes[(size_t) (hash >> 48) & (EMBLIB_CONCURRENT_SET_STRIPES - 1)];
+}
+
+/**
+ * @brief copy a slot with relaxed atomic loads; the copy may be torn, the sequence lock tells
+ */
+static void concurrent_set_load_slot(char *dest, const char *src, size_t size) {
+    if (((uintptr_t) src | size) % sizeof(uint32_t) == 0) {
+        for (size_t i = 0; i < size; i += sizeof(uint32_t)) {
+            const uint32_t word = EMBLIB_LF_LOAD((const uint32_t *) (src + i), EMBLIB_LF_RELAXED);
+            memcpy(dest + i, &word, sizeof(word));
+        }
+    } else {
+        for (size_t i = 0; i < size; i++) {
+            dest[i] = (char) EMBLIB_LF_LOAD((const uint8_t *) (src + i), EMBLIB_LF_RELAXED);
+        }
+    }
+}
+
+bool emblib_concurrent_set_init(emblib_concurrent_set_t *set, void *array, size_t buffer_len, size_t size_elem,
+                                void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
+                                int (*cmp_fn)(void *right, void *left), uint64_t (*hash_fn)(void *data)) {
+    if (!set || !array || !hash_fn) return false;
+
+    // keep every stripe buffer aligned like array
+    const size_t stripe_len = buffer_len / EMBLIB_CONCURRENT_SET_STRIPES & ~(size_t) 7;
+
+    for (size_t i = 0; i < EMBLIB_CONCURRENT_SET_STRIPES; i++) {
+        emblib_concurrent_set_stripe_t *stripe = &set->stripes[i];
+        if (!emblib_hash_set_init(&stripe->table, (char *) array + i * stripe_len, stripe_len, size_elem,
+                                  copy_fn, free_fn, cmp_fn, hash_fn)) {
+            return false;
+        }
+        stripe->seq = 0;
+    }
+    for (size_t i = 0; i < EMBLIB_CONCURRENT_SET_STRIPES; i++) {
+        (void) EMBLIB_MUTEX_INIT(&set->stripes[i].lock);
+    }
+    set->hash_fn = hash_fn;
+    return true;
+}
+
+void emblib_concurrent_set_destroy(emblib_concurrent_set_t *set) {
+    if (set) {
+        for (size_t i = 0; i < EMBLIB_CONCURRENT_SET_STRIPES; i++) {
+            EMBLIB_MUTEX_DESTROY(&set->stripes[i].lock);
+        }
+    }
+}
+
+bool emblib_concurrent_set_add(emblib_concurrent_set_t *set, void *data) {
+    if (!set || !data) return false;
+
+    emblib_concurrent_set_stripe_t *stripe = concurrent_set_stripe(set, set->hash_fn(data));
+    EMBLIB_MUTEX_LOCK(&stripe->lock);
+    emblib_seqlock_write_lock(&stripe->seq);
+    const bool added = emblib_hash_set_add(&stripe->table, data);
+    emblib_seqlock_write_unlock(&stripe->seq);
+    EMBLIB_MUTEX_UNLOCK(&stripe->lock);
+    return added;
+}
+
+bool emblib_concurrent_set_remove(emblib_concurrent_set_t *set, void *data) {
+    if (!set || !data) return false;
+
+    emblib_concurrent_set_stripe_t *stripe = concurrent_set_stripe(set, set->hash_fn(data));
+    EMBLIB_MUTEX_LOCK(&stripe->lock);
+    emblib_seqlock_write_lock(&stripe->seq);
+    const bool removed = emblib_hash_set_remove(&stripe->table, data);
+    emblib_seqlock_write_unlock(&stripe->seq);
+    EMBLIB_MUTEX_UNLOCK(&stripe->lock);
+    return removed;
+}
+
+bool emblib_concurrent_set_contains(emblib_concurrent_set_t *set, void *data) {
+    if (!set || !data) return false;
+
+    const uint64_t hash = set->hash_fn(data);
+    emblib_concurrent_set_stripe_t *stripe = concurrent_set_stripe(set, hash);
+
+    // the layout of the table (array, dist, capacity, elem_size) does not change after init
+    emblib_hash_set_t *table = &stripe->table;
+    const size_t mask = table->capacity - 1;
+    char slot[table->elem_size];
+    unsigned seq;
+    bool found;
+    do {
+        seq = emblib_seqlock_read_begin(&stripe->seq);
+        found = false;
+
+        // same probe as emblib_hash_set_contains, over atomic copies of the shared memory
+        size_t index = (size_t) hash & mask;
+        for (size_t d = 1;; d++) {
+            const uint8_t dist = EMBLIB_LF_LOAD(&table->dist[index], EMBLIB_LF_RELAXED);
+            if (dist < d) break;
+            if (dist == d) {
+                concurrent_set_load_slot(slot, (char *) table->array + index * table->elem_size, table->elem_size);
+                // a torn copy never reaches cmp_fn
+                if (emblib_seqlock_read_retry(&stripe->seq, seq)) break;
+                if (table->cmp_fn(slot, data) == 0) {
+                    found = true;
+                    break;
+                }
+            }
+            index = (index + 1) & mask;
+        }
+    } while (emblib_seqlock_read_retry(&stripe->seq, seq));
+    return found;
+}
+
+size_t emblib_concurrent_set_count(emblib_concurrent_set_t *set) {
+    if (!set) return 0;
+
+    size_t count = 0;
+    for (size_t i = 0; i < EMBLIB_CONCURRENT_SET_STRIPES; i++) {
+        count += EMBLIB_LF_LOAD(&set->stripes[i].table.count, EMBLIB_LF_RELAXED);
+    }
+    return count;
+}
+
+void emblib_concurrent_set_flush(emblib_concurrent_set_t *set) {
+    if (set) {
+        for (size_t i = 0; i < EMBLIB_CONCURRENT_SET_STRIPES; i++) {
+            emblib_concurrent_set_stripe_t *stripe = &set->stripes[i];
+            EMBLIB_MUTEX_LOCK(&stripe->lock);
+            emblib_seqlock_write_lock(&stripe->seq);
+            emblib_hash_set_flush(&stripe->table);
+            emblib_seqlock_write_unlock(&stripe->seq);
+            EMBLIB_MUTEX_UNLOCK(&stripe->lock);
+        }
+    }
+}
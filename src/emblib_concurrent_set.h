@@ -0,0 +1,105 @@
+#ifndef __EMB_LIB_EMBLIB_CONCURRENT_SET_H__
+#define __EMB_LIB_EMBLIB_CONCURRENT_SET_H__
+
+#include "emblib_hash_set.h"
+#include "emblib_thread_safety.h"
+
+#ifndef EMBLIB_CONCURRENT_SET_STRIPES
+//! number of independently locked sub-tables, power of two
+#define EMBLIB_CONCURRENT_SET_STRIPES 8
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define EMBLIB_CONCURRENT_SET_ALIGN __attribute__((aligned(64)))
+#else
+#define EMBLIB_CONCURRENT_SET_ALIGN
+#endif
+
+/**
+ * @brief One stripe: a hash set guarded by a sequence lock for the readers and a mutex
+ *        for the writers. Aligned on a cache line so that stripes do not share one.
+ */
+typedef struct _emblib_concurrent_set_stripe_t {
+    emblib_seqlock_t seq;       //!< odd while a writer modifies table
+    emblib_mutex_t lock;        //!< serializes the writers of the stripe
+    emblib_hash_set_t table;    //!< elements whose hash selects this stripe
+} EMBLIB_CONCURRENT_SET_ALIGN emblib_concurrent_set_stripe_t;
+
+/**
+ * @brief Thread-safe hash set for read-mostly workloads. The caller buffer is split into
+ *        EMBLIB_CONCURRENT_SET_STRIPES Robin Hood hash sets picked by the high bits of the hash.
+ *        contains takes no lock and writes no shared memory: it copies each probed slot with
+ *        atomic loads and checks the sequence lock before calling cmp_fn on the copy, so cmp_fn
+ *        never sees a torn element; it retries if a writer ran meanwhile. add and remove lock
+ *        one stripe only.
+ */
+typedef struct _emblib_concurrent_set_t {
+    emblib_concurrent_set_stripe_t stripes[EMBLIB_CONCURRENT_SET_STRIPES];
+    uint64_t (*hash_fn)(void *data);        //! hash function
+} emblib_concurrent_set_t;
+
+/**
+ * @brief Initializes the set. Not thread-safe.
+ *
+ * @param set Pointer to the set structure.
+ * @param array Pointer to the memory where elements will be stored.
+ * @param buffer_len Size in bytes of array, shared equally by the stripes.
+ * @param size_elem Size of each element in bytes.
+ * @param hash_fn Hash function. Equal elements must have the same hash; the high bits pick the stripe.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_concurrent_set_init(emblib_concurrent_set_t *set, void *array, size_t buffer_len, size_t size_elem,
+                                void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
+                                int (*cmp_fn)(void *right, void *left), uint64_t (*hash_fn)(void *data));
+
+/**
+ * @brief Releases the stripe locks. Not thread-safe.
+ *
+ * @param set Pointer to the set structure.
+ */
+void emblib_concurrent_set_destroy(emblib_concurrent_set_t *set);
+
+/**
+ * @brief Adds an element to the set. Locks one stripe.
+ *
+ * @param set Pointer to the set structure.
+ * @param data Pointer to the element to be added.
+ * @return true if the add is successful, false if the element already exists or its stripe is full.
+ */
+bool emblib_concurrent_set_add(emblib_concurrent_set_t *set, void *data);
+
+/**
+ * @brief Removes an element from the set. Locks one stripe.
+ *
+ * @param set Pointer to the set structure.
+ * @param data Pointer to the element to be removed.
+ * @return true if the remove is successful, false otherwise.
+ */
+bool emblib_concurrent_set_remove(emblib_concurrent_set_t *set, void *data);
+
+/**
+ * @brief Checks if the set contains a specific element. Lock-free; retries while a writer
+ *        modifies the stripe.
+ *
+ * @param set Pointer to the set structure.
+ * @param data Pointer to the element to check.
+ * @return true if the set contains the element, false otherwise.
+ */
+bool emblib_concurrent_set_contains(emblib_concurrent_set_t *set, void *data);
+
+/**
+ * @brief Returns the number of elements stored in the set. Only a snapshot while writers run.
+ *
+ * @param set Pointer to the set structure.
+ * @return Number of elements in the set.
+ */
+size_t emblib_concurrent_set_count(emblib_concurrent_set_t *set);
+
+/**
+ * @brief Clears all elements from the set, one stripe at a time.
+ *
+ * @param set Pointer to the set structure.
+ */
+void emblib_concurrent_set_flush(emblib_concurrent_set_t *set);
+
+#endif //__EMB_LIB_EMBLIB_CONCURRENT_SET_H__
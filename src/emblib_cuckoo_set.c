@@ -0,0 +1,229 @@
+#include "emblib_cuckoo_set.h"
+#include <string.h>
+
+#define CUCKOO_SET_HEADER 8
+
+static uint8_t *cuckoo_set_tags(emblib_cuckoo_set_t *set, size_t bucket) {
+    return (uint8_t *) set->array + bucket * set->bucket_size;
+}
+
+static char *cuckoo_set_slot(emblib_cuckoo_set_t *set, size_t bucket, size_t slot) {
+    return (char *) set->array + bucket * set->bucket_size + CUCKOO_SET_HEADER + slot * set->elem_size;
+}
+
+static uint8_t cuckoo_set_tag(uint64_t hash) {
+    const uint8_t tag = (uint8_t) (hash >> 56);
+    return tag ? tag : 1;
+}
+
+static size_t cuckoo_set_first(emblib_cuckoo_set_t *set, uint64_t hash) {
+    return (size_t) hash & (set->buckets - 1);
+}
+
+static size_t cuckoo_set_second(emblib_cuckoo_set_t *set, uint64_t hash) {
+    const size_t first = cuckoo_set_first(set, hash);
+    const size_t second = (size_t) (hash >> 32) & (set->buckets - 1);
+    return second != first ? second : first ^ 1;
+}
+
+static size_t cuckoo_set_other(emblib_cuckoo_set_t *set, uint64_t hash, size_t bucket) {
+    const size_t first = cuckoo_set_first(set, hash);
+    return bucket == first ? cuckoo_set_second(set, hash) : first;
+}
+
+static bool cuckoo_set_find_in(emblib_cuckoo_set_t *set, size_t bucket, uint8_t tag, void *data, size_t *slot) {
+    const uint8_t *tags = cuckoo_set_tags(set, bucket);
+    for (size_t i = 0; i < EMBLIB_CUCKOO_SET_SLOTS; i++) {
+        if (tags[i] == tag && set->cmp_fn(cuckoo_set_slot(set, bucket, i), data) == 0) {
+            *slot = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool cuckoo_set_free_in(emblib_cuckoo_set_t *set, size_t bucket, size_t *slot) {
+    const uint8_t *tags = cuckoo_set_tags(set, bucket);
+    for (size_t i = 0; i < EMBLIB_CUCKOO_SET_SLOTS; i++) {
+        if (!tags[i]) {
+            *slot = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief move the element at src (already owned by the set) into one of its buckets, without evicting
+ */
+static bool cuckoo_set_place(emblib_cuckoo_set_t *set, void *src, uint64_t hash) {
+    size_t bucket = cuckoo_set_first(set, hash), slot;
+    if (!cuckoo_set_free_in(set, bucket, &slot)) {
+        bucket = cuckoo_set_second(set, hash);
+        if (!cuckoo_set_free_in(set, bucket, &slot)) return false;
+    }
+    memcpy(cuckoo_set_slot(set, bucket, slot), src, set->elem_size);
+    cuckoo_set_tags(set, bucket)[slot] = cuckoo_set_tag(hash);
+    return true;
+}
+
+size_t emblib_cuckoo_set_bucket_size(size_t size_elem) {
+    const size_t size = CUCKOO_SET_HEADER + EMBLIB_CUCKOO_SET_SLOTS * size_elem;
+    return (size + EMBLIB_CUCKOO_SET_LINE - 1) & ~(size_t) (EMBLIB_CUCKOO_SET_LINE - 1);
+}
+
+bool emblib_cuckoo_set_init(emblib_cuckoo_set_t *set, void *array, size_t buffer_len, size_t size_elem,
+                            void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
+                            int (*cmp_fn)(void *right, void *left), uint64_t (*hash_fn)(void *data)) {
+    if (!set || !array || !size_elem || !copy_fn || !cmp_fn || !hash_fn) return false;
+
+    // start the buckets on a cache line
+    const size_t skip = (EMBLIB_CUCKOO_SET_LINE - (uintptr_t) array % EMBLIB_CUCKOO_SET_LINE) % EMBLIB_CUCKOO_SET_LINE;
+    if (buffer_len < skip) return false;
+    array = (char *) array + skip;
+    buffer_len -= skip;
+
+    const size_t bucket_size = emblib_cuckoo_set_bucket_size(size_elem);
+    if (buffer_len < size_elem || (buffer_len - size_elem) / bucket_size < 2) return false;
+
+    size_t buckets = 2;
+    while (buckets * 2 <= (buffer_len - size_elem) / bucket_size) {
+        buckets *= 2;
+    }
+
+    const size_t slots = buckets * EMBLIB_CUCKOO_SET_SLOTS;
+    *set = (emblib_cuckoo_set_t) {
+            .array       = array,
+            .stash       = (char *) array + buckets * bucket_size,
+            .stash_used  = false,
+            .buckets     = buckets,
+            .bucket_size = bucket_size,
+            .max_count   = slots - slots / 16,
+            .count       = 0,
+            .elem_size   = size_elem,
+            .victim      = 0,
+            .copy_fn     = copy_fn,
+            .free_fn     = free_fn,
+            .cmp_fn      = cmp_fn,
+            .hash_fn     = hash_fn
+    };
+    for (size_t b = 0; b < buckets; b++) {
+        memset(cuckoo_set_tags(set, b), 0, CUCKOO_SET_HEADER);
+    }
+    return true;
+}
+
+bool emblib_cuckoo_set_add(emblib_cuckoo_set_t *set, void *data) {
+    if (!set || !data || emblib_cuckoo_set_is_full(set) || emblib_cuckoo_set_contains(set, data)) return false;
+
+    char cur[set->elem_size];
+    char tmp[set->elem_size];
+    uint64_t hash = set->hash_fn(data);
+
+    set->copy_fn(cur, data);
+    if (cuckoo_set_place(set, cur, hash)) {
+        set->count++;
+        return true;
+    }
+
+    // both buckets are full: the walk ends with a homeless element that needs the stash
+    if (set->stash_used) {
+        if (set->free_fn) set->free_fn(cur);
+        return false;
+    }
+
+    size_t bucket = cuckoo_set_first(set, hash);
+    for (uint32_t kick = 0; kick < EMBLIB_CUCKOO_SET_MAX_KICKS; kick++) {
+        const size_t slot = set->victim++ % EMBLIB_CUCKOO_SET_SLOTS;
+        char *victim = cuckoo_set_slot(set, bucket, slot);
+
+        memcpy(tmp, victim, set->elem_size);
+        memcpy(victim, cur, set->elem_size);
+        cuckoo_set_tags(set, bucket)[slot] = cuckoo_set_tag(hash);
+        memcpy(cur, tmp, set->elem_size);
+
+        hash = set->hash_fn(cur);
+        bucket = cuckoo_set_other(set, hash, bucket);
+
+        size_t free_slot;
+        if (cuckoo_set_free_in(set, bucket, &free_slot)) {
+            memcpy(cuckoo_set_slot(set, bucket, free_slot), cur, set->elem_size);
+            cuckoo_set_tags(set, bucket)[free_slot] = cuckoo_set_tag(hash);
+            set->count++;
+            return true;
+        }
+    }
+
+    memcpy(set->stash, cur, set->elem_size);
+    set->stash_used = true;
+    set->count++;
+    return true;
+}
+
+bool emblib_cuckoo_set_remove(emblib_cuckoo_set_t *set, void *data) {
+    if (!set || !data || !set->count) return false;
+
+    if (set->stash_used && set->cmp_fn(set->stash, data) == 0) {
+        set->stash_used = false;
+        set->count--;
+        return true;
+    }
+
+    const uint64_t hash = set->hash_fn(data);
+    const uint8_t tag = cuckoo_set_tag(hash);
+    size_t bucket = cuckoo_set_first(set, hash), slot;
+    if (!cuckoo_set_find_in(set, bucket, tag, data, &slot)) {
+        bucket = cuckoo_set_second(set, hash);
+        if (!cuckoo_set_find_in(set, bucket, tag, data, &slot)) return false;
+    }
+    cuckoo_set_tags(set, bucket)[slot] = 0;
+    set->count--;
+
+    // the freed slot may be one of the stashed element's buckets
+    if (set->stash_used && cuckoo_set_place(set, set->stash, set->hash_fn(set->stash))) {
+        set->stash_used = false;
+    }
+    return true;
+}
+
+bool emblib_cuckoo_set_contains(emblib_cuckoo_set_t *set, void *data) {
+    if (!set || !data || !set->count) return false;
+
+    const uint64_t hash = set->hash_fn(data);
+    const uint8_t tag = cuckoo_set_tag(hash);
+    size_t slot;
+    return cuckoo_set_find_in(set, cuckoo_set_first(set, hash), tag, data, &slot) ||
+           cuckoo_set_find_in(set, cuckoo_set_second(set, hash), tag, data, &slot) ||
+           (set->stash_used && set->cmp_fn(set->stash, data) == 0);
+}
+
+size_t emblib_cuckoo_set_size(emblib_cuckoo_set_t *set) {
+    return set ? set->max_count : 0;
+}
+
+size_t emblib_cuckoo_set_count(emblib_cuckoo_set_t *set) {
+    return set ? set->count : 0;
+}
+
+void emblib_cuckoo_set_flush(emblib_cuckoo_set_t *set) {
+    if (set) {
+        for (size_t b = 0; b < set->buckets; b++) {
+            uint8_t *tags = cuckoo_set_tags(set, b);
+            for (size_t i = 0; i < EMBLIB_CUCKOO_SET_SLOTS && set->free_fn; i++) {
+                if (tags[i]) set->free_fn(cuckoo_set_slot(set, b, i));
+            }
+            memset(tags, 0, CUCKOO_SET_HEADER);
+        }
+        if (set->stash_used && set->free_fn) set->free_fn(set->stash);
+        set->stash_used = false;
+        set->count = 0;
+    }
+}
+
+bool emblib_cuckoo_set_is_full(emblib_cuckoo_set_t *set) {
+    return set ? set->count >= set->max_count : false;
+}
+
+bool emblib_cuckoo_set_is_empty(emblib_cuckoo_set_t *set) {
+    return set ? set->count == 0 : false;
+}
@@ -0,0 +1,128 @@
+#ifndef __EMB_LIB_EMBLIB_CUCKOO_SET_H__
+#define __EMB_LIB_EMBLIB_CUCKOO_SET_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+//! slots of a bucket
+#define EMBLIB_CUCKOO_SET_SLOTS 4
+
+//! cache line size: buckets are aligned on it and padded to a multiple of it
+#define EMBLIB_CUCKOO_SET_LINE 64
+
+#ifndef EMBLIB_CUCKOO_SET_MAX_KICKS
+//! evictions tried by an add before the homeless element goes to the stash
+#define EMBLIB_CUCKOO_SET_MAX_KICKS 128
+#endif
+
+/**
+ * @brief Cuckoo hash set: every element lives in one of its two candidate buckets of 4 slots
+ *        (or in the one-element stash), so a lookup reads at most two buckets whatever the load.
+ *        A bucket is an 8-byte header with one tag byte per slot (8 bits of hash, 0 for an empty
+ *        slot) followed by its slots; cmp_fn is only called when the tag matches.
+ *        Buckets are aligned on EMBLIB_CUCKOO_SET_LINE and padded to a multiple of it, so with
+ *        elements up to 14 bytes a bucket is one cache line and a lookup touches at most two
+ *        lines (plus the stash when it is used). Larger elements take
+ *        emblib_cuckoo_set_bucket_size(size_elem) / EMBLIB_CUCKOO_SET_LINE lines per bucket.
+ *        The caller buffer holds the buckets followed by the stash; the number of buckets is the
+ *        largest power of two (at least 2) that fits. Adds may fail before max_count on unlucky
+ *        hashes.
+ */
+typedef struct _emblib_cuckoo_set_t {
+    void *array;            //!< buckets
+    void *stash;            //!< element that found no bucket
+    bool stash_used;        //!< stash holds an element
+    size_t buckets;         //!< number of buckets (power of two)
+    size_t bucket_size;     //!< size of a bucket in bytes
+    size_t max_count;       //!< maximum number of elements (15/16 of the slots)
+    size_t count;           //!< number of elements stored (stash included)
+    size_t elem_size;       //!< size of each element
+    uint32_t victim;        //!< rotates the slot evicted by an add
+    void (*copy_fn)(void *dest, void *src); //! copy function
+    void (*free_fn)(void *data);            //! free function
+    int (*cmp_fn)(void *right, void *left); //! compare function, 0 when equal
+    uint64_t (*hash_fn)(void *data);        //! hash function
+} emblib_cuckoo_set_t;
+
+/**
+ * @brief Size in bytes of a bucket for size_elem (a multiple of EMBLIB_CUCKOO_SET_LINE), to
+ *        dimension the caller buffer: buckets * emblib_cuckoo_set_bucket_size(size_elem) +
+ *        size_elem, plus EMBLIB_CUCKOO_SET_LINE - 1 bytes when array is not aligned on a line.
+ *
+ * @param size_elem Size of each element in bytes.
+ * @return bucket size in bytes.
+ */
+size_t emblib_cuckoo_set_bucket_size(size_t size_elem);
+
+/**
+ * @brief Initializes the set.
+ *
+ * @param set Pointer to the set structure.
+ * @param array Pointer to the memory where elements will be stored. The buckets start at the
+ *              first EMBLIB_CUCKOO_SET_LINE boundary of array.
+ * @param buffer_len Size in bytes of array.
+ * @param size_elem Size of each element in bytes.
+ * @param hash_fn Hash function. Equal elements must have the same hash; both halves of the
+ *                64 bits are used.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_cuckoo_set_init(emblib_cuckoo_set_t *set, void *array, size_t buffer_len, size_t size_elem,
+                            void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
+                            int (*cmp_fn)(void *right, void *left), uint64_t (*hash_fn)(void *data));
+
+/**
+ * @brief Adds an element to the set. O(1) expected, at most EMBLIB_CUCKOO_SET_MAX_KICKS evictions.
+ *
+ * @param set Pointer to the set structure.
+ * @param data Pointer to the element to be added.
+ * @return true if the add is successful, false if the element already exists or there is no room for it.
+ */
+bool emblib_cuckoo_set_add(emblib_cuckoo_set_t *set, void *data);
+
+/**
+ * @brief Removes an element from the set. O(1).
+ *
+ * @param set Pointer to the set structure.
+ * @param data Pointer to the element to be removed.
+ * @return true if the remove is successful, false otherwise.
+ */
+bool emblib_cuckoo_set_remove(emblib_cuckoo_set_t *set, void *data);
+
+/**
+ * @brief Checks if the set contains a specific element. O(1) worst case: two buckets and the stash.
+ *
+ * @param set Pointer to the set structure.
+ * @param data Pointer to the element to check.
+ * @return true if the set contains the element, false otherwise.
+ */
+bool emblib_cuckoo_set_contains(emblib_cuckoo_set_t *set, void *data);
+
+/**
+ * @brief Returns the maximum number of elements of the set.
+ *
+ * @param set Pointer to the set structure.
+ * @return Maximum number of elements.
+ */
+size_t emblib_cuckoo_set_size(emblib_cuckoo_set_t *set);
+
+/**
+ * @brief Returns the number of elements currently stored in the set.
+ *
+ * @param set Pointer to the set structure.
+ * @return Number of elements in the set.
+ */
+size_t emblib_cuckoo_set_count(emblib_cuckoo_set_t *set);
+
+/**
+ * @brief Clears all elements from the set.
+ *
+ * @param set Pointer to the set structure.
+ */
+void emblib_cuckoo_set_flush(emblib_cuckoo_set_t *set);
+
+bool emblib_cuckoo_set_is_full(emblib_cuckoo_set_t *set);
+
+bool emblib_cuckoo_set_is_empty(emblib_cuckoo_set_t *set);
+
+#endif //__EMB_LIB_EMBLIB_CUCKOO_SET_H__
@@ -44,6 +44,64 @@ bool emblib_deque_pop_back(emblib_deque_t *deque, void *data) {
     return bRet;
 }
 
+/**
+ * @brief copy n elements from data into the array starting at slot first, wrapping once at most
+ */
+static void deque_copy_in(emblib_deque_t *deque, size_t first, const void *data, size_t n) {
+    const size_t size = emblib_deque_size(deque);
+    const size_t chunk = n < size - first ? n : size - first;
+    memcpy((char *) deque->array + first * deque->elem_size, data, chunk * deque->elem_size);
+    memcpy(deque->array, (const char *) data + chunk * deque->elem_size, (n - chunk) * deque->elem_size);
+}
+
+/**
+ * @brief copy n elements of the array starting at slot first into data, wrapping once at most
+ */
+static void deque_copy_out(emblib_deque_t *deque, size_t first, void *data, size_t n) {
+    const size_t size = emblib_deque_size(deque);
+    const size_t chunk = n < size - first ? n : size - first;
+    memcpy(data, (char *) deque->array + first * deque->elem_size, chunk * deque->elem_size);
+    memcpy((char *) data + chunk * deque->elem_size, deque->array, (n - chunk) * deque->elem_size);
+}
+
+bool emblib_deque_push_back_n(emblib_deque_t *deque, void *data, size_t n) {
+    if (!deque || !data || n > emblib_deque_size(deque) - emblib_deque_count(deque)) return false;
+
+    deque_copy_in(deque, deque->tail, data, n);
+    deque->tail = (deque->tail + n) % emblib_deque_size(deque);
+    deque->count += n;
+    return true;
+}
+
+bool emblib_deque_push_front_n(emblib_deque_t *deque, void *data, size_t n) {
+    if (!deque || !data || n > emblib_deque_size(deque) - emblib_deque_count(deque)) return false;
+
+    const size_t size = emblib_deque_size(deque);
+    deque->head = (deque->head + size - n % size) % size;
+    deque_copy_in(deque, deque->head, data, n);
+    deque->count += n;
+    return true;
+}
+
+bool emblib_deque_pop_front_n(emblib_deque_t *deque, void *data, size_t n) {
+    if (!deque || !data || n > emblib_deque_count(deque)) return false;
+
+    deque_copy_out(deque, deque->head, data, n);
+    deque->head = (deque->head + n) % emblib_deque_size(deque);
+    deque->count -= n;
+    return true;
+}
+
+bool emblib_deque_pop_back_n(emblib_deque_t *deque, void *data, size_t n) {
+    if (!deque || !data || n > emblib_deque_count(deque)) return false;
+
+    const size_t size = emblib_deque_size(deque);
+    deque->tail = (deque->tail + size - n % size) % size;
+    deque_copy_out(deque, deque->tail, data, n);
+    deque->count -= n;
+    return true;
+}
+
 bool emblib_deque_peek_front(emblib_deque_t *deque, void *data) {
     bool bRet = false;
     if (!emblib_deque_is_empty(deque)) {
@@ -65,6 +123,16 @@ bool emblib_deque_peek_back(emblib_deque_t *deque, void *data) {
     return bRet;
 }
 
+bool emblib_deque_at(emblib_deque_t *deque, size_t index, void *data) {
+    bool bRet = false;
+    if (deque && data && index < emblib_deque_count(deque)) {
+        const size_t size = emblib_deque_size(deque);
+        memcpy(data, (char *) deque->array + ((deque->head + index) % size) * deque->elem_size, deque->elem_size);
+        bRet = true;
+    }
+    return bRet;
+}
+
 bool emblib_deque_is_empty(emblib_deque_t *deque) {
     return emblib_circ_buffer_is_empty(deque);
 }
@@ -80,3 +148,69 @@ size_t emblib_deque_size(emblib_deque_t *deque) {
 size_t emblib_deque_count(emblib_deque_t *deque) {
     return emblib_circ_buffer_count(deque);
 }
+
+static void deque_window_seq_copy(void *dest, void *src) {
+    memcpy(dest, src, sizeof(size_t));
+}
+
+static void *deque_window_value(emblib_deque_window_t *win, size_t seq) {
+    return (char *) win->values + (seq % win->window) * win->elem_size;
+}
+
+bool emblib_deque_window_init(emblib_deque_window_t *win, void *array, size_t buffer_len, size_t window,
+                              size_t size_elem, int (*cmp_fn)(void *left, void *right)) {
+    if (!win || !array || !window || !size_elem || !cmp_fn) return false;
+    if (buffer_len / window < sizeof(size_t) + size_elem) return false;
+
+    if (!emblib_deque_init(&win->candidates, array, window * sizeof(size_t), sizeof(size_t),
+                           deque_window_seq_copy, NULL)) {
+        return false;
+    }
+    win->values = (char *) array + window * sizeof(size_t);
+    win->window = window;
+    win->next_seq = 0;
+    win->elem_size = size_elem;
+    win->cmp_fn = cmp_fn;
+    return true;
+}
+
+bool emblib_deque_window_push(emblib_deque_window_t *win, void *data) {
+    if (!win || !data) return false;
+
+    const size_t seq = win->next_seq++;
+    size_t candidate;
+
+    // the front leaves before its ring slot is reused
+    while (emblib_deque_peek_front(&win->candidates, &candidate) && candidate + win->window <= seq) {
+        emblib_deque_pop_front(&win->candidates, &candidate);
+    }
+
+    memcpy(deque_window_value(win, seq), data, win->elem_size);
+
+    // candidates not greater than the new sample can never be the maximum again
+    while (emblib_deque_peek_back(&win->candidates, &candidate) &&
+           win->cmp_fn(deque_window_value(win, candidate), data) <= 0) {
+        emblib_deque_pop_back(&win->candidates, &candidate);
+    }
+    return emblib_deque_push_back(&win->candidates, (void *) &seq);
+}
+
+bool emblib_deque_window_get(emblib_deque_window_t *win, void *data) {
+    size_t candidate;
+    if (!win || !data || !emblib_deque_peek_front(&win->candidates, &candidate)) return false;
+
+    memcpy(data, deque_window_value(win, candidate), win->elem_size);
+    return true;
+}
+
+size_t emblib_deque_window_count(emblib_deque_window_t *win) {
+    if (!win) return 0;
+    return win->next_seq < win->window ? win->next_seq : win->window;
+}
+
+void emblib_deque_window_flush(emblib_deque_window_t *win) {
+    if (win) {
+        emblib_deque_flush(&win->candidates);
+        win->next_seq = 0;
+    }
+}
@@ -63,6 +63,50 @@ bool emblib_deque_pop_front(emblib_deque_t *deque, void *data);
  */
 bool emblib_deque_pop_back(emblib_deque_t *deque, void *data);
 
+/**
+ * @brief Pushes n elements to the back of the deque, data[n - 1] becomes the back.
+ *        The elements are copied with memcpy in at most two blocks (copy_fn is not called).
+ *
+ * @param[in,out] deque Pointer to the deque structure.
+ * @param[in] data Pointer to the elements to be pushed.
+ * @param[in] n Number of elements.
+ * @return true if the push is successful, false if the deque has no room for n elements (nothing is pushed).
+ */
+bool emblib_deque_push_back_n(emblib_deque_t *deque, void *data, size_t n);
+
+/**
+ * @brief Pushes n elements to the front of the deque as one block: data[0] becomes the front
+ *        and data[n - 1] is followed by the former front.
+ *        The elements are copied with memcpy in at most two blocks (copy_fn is not called).
+ *
+ * @param[in,out] deque Pointer to the deque structure.
+ * @param[in] data Pointer to the elements to be pushed.
+ * @param[in] n Number of elements.
+ * @return true if the push is successful, false if the deque has no room for n elements (nothing is pushed).
+ */
+bool emblib_deque_push_front_n(emblib_deque_t *deque, void *data, size_t n);
+
+/**
+ * @brief Pops n elements from the front of the deque, data[0] receives the former front.
+ *
+ * @param[in,out] deque Pointer to the deque structure.
+ * @param[out] data Pointer to the memory where the n popped elements will be stored.
+ * @param[in] n Number of elements.
+ * @return true if the pop is successful, false if the deque holds less than n elements (nothing is popped).
+ */
+bool emblib_deque_pop_front_n(emblib_deque_t *deque, void *data, size_t n);
+
+/**
+ * @brief Pops n elements from the back of the deque, in deque order: data[n - 1] receives the
+ *        former back.
+ *
+ * @param[in,out] deque Pointer to the deque structure.
+ * @param[out] data Pointer to the memory where the n popped elements will be stored.
+ * @param[in] n Number of elements.
+ * @return true if the pop is successful, false if the deque holds less than n elements (nothing is popped).
+ */
+bool emblib_deque_pop_back_n(emblib_deque_t *deque, void *data, size_t n);
+
 /**
  * @brief Peeks an element from the front of the deque.
  *
@@ -81,6 +125,16 @@ bool emblib_deque_peek_front(emblib_deque_t *deque, void *data);
  */
 bool emblib_deque_peek_back(emblib_deque_t *deque, void *data);
 
+/**
+ * @brief Copies the element at a position, O(1).
+ *
+ * @param[in] deque Pointer to the deque structure.
+ * @param[in] index Position of the element, 0 for the front.
+ * @param[out] data Pointer to the memory where the element will be stored.
+ * @return true on success, false if index is out of range.
+ */
+bool emblib_deque_at(emblib_deque_t *deque, size_t index, void *data);
+
 /**
  * @brief Checks if the deque is empty.
  *
@@ -113,4 +167,69 @@ size_t emblib_deque_size(emblib_deque_t *deque);
  */
 size_t emblib_deque_count(emblib_deque_t *deque);
 
+/**
+ * @brief Maximum of the last `window` samples of a stream, amortized O(1) per sample.
+ *        A deque keeps the sequence numbers of the samples that can still become the maximum,
+ *        in decreasing order: a new sample drops the candidates it dominates from the back, and
+ *        the front leaves once it falls out of the window. The samples themselves live in a
+ *        ring of the last `window` values.
+ *        For a minimum, pass a reversed cmp_fn.
+ */
+typedef struct _emblib_deque_window_t {
+    emblib_deque_t candidates;  //!< sequence numbers (size_t) of the candidates, front is the maximum
+    void *values;               //!< ring of the last window samples, indexed by sequence % window
+    size_t window;              //!< number of samples in the window
+    size_t next_seq;            //!< sequence number of the next sample
+    size_t elem_size;           //!< size of a sample
+    int (*cmp_fn)(void *left, void *right); //! compare function, > 0 when left is greater
+} emblib_deque_window_t;
+
+/**
+ * @brief Initializes the window.
+ *
+ * @param[in,out] win Pointer to the window structure.
+ * @param[in] array Pointer to the memory of the window, at least window * (sizeof(size_t) + size_elem)
+ *                  bytes, aligned for size_t.
+ * @param[in] buffer_len Size in bytes of array.
+ * @param[in] window Number of samples in the window.
+ * @param[in] size_elem Size of a sample in bytes.
+ * @param[in] cmp_fn Compare function, > 0 when left is greater than right.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_deque_window_init(emblib_deque_window_t *win, void *array, size_t buffer_len, size_t window,
+                              size_t size_elem, int (*cmp_fn)(void *left, void *right));
+
+/**
+ * @brief Adds a sample, the oldest one leaves the window once it is full.
+ *
+ * @param[in,out] win Pointer to the window structure.
+ * @param[in] data Pointer to the sample.
+ * @return true on success, false on invalid arguments.
+ */
+bool emblib_deque_window_push(emblib_deque_window_t *win, void *data);
+
+/**
+ * @brief Copies the maximum of the window, O(1).
+ *
+ * @param[in] win Pointer to the window structure.
+ * @param[out] data Pointer to the memory where the maximum will be stored.
+ * @return true on success, false if no sample was pushed.
+ */
+bool emblib_deque_window_get(emblib_deque_window_t *win, void *data);
+
+/**
+ * @brief Returns the number of samples currently in the window.
+ *
+ * @param[in] win Pointer to the window structure.
+ * @return Number of samples, at most window.
+ */
+size_t emblib_deque_window_count(emblib_deque_window_t *win);
+
+/**
+ * @brief Clears all samples from the window.
+ *
+ * @param[in,out] win Pointer to the window structure.
+ */
+void emblib_deque_window_flush(emblib_deque_window_t *win);
+
 #endif //~__DEQUE_H__
@@ -0,0 +1,121 @@
+#include "emblib_dheap.h"
+#include <string.h>
+
+/**
+ * @brief key of element index: the root sits at slot d - 1, so children groups start on multiples of d
+ */
+static char *dheap_key(emblib_dheap_t *heap, size_t index) {
+    return (char *) heap->keys + (index + heap->arity - 1) * heap->key_size;
+}
+
+static char *dheap_payload(emblib_dheap_t *heap, size_t index) {
+    return (char *) heap->payloads + index * heap->payload_size;
+}
+
+static void dheap_move(emblib_dheap_t *heap, size_t dest, size_t src) {
+    memcpy(dheap_key(heap, dest), dheap_key(heap, src), heap->key_size);
+    if (heap->payload_size) memcpy(dheap_payload(heap, dest), dheap_payload(heap, src), heap->payload_size);
+}
+
+static void dheap_put(emblib_dheap_t *heap, size_t index, void *key, void *payload) {
+    memcpy(dheap_key(heap, index), key, heap->key_size);
+    if (heap->payload_size) memcpy(dheap_payload(heap, index), payload, heap->payload_size);
+}
+
+bool emblib_dheap_init(emblib_dheap_t *heap, void *array, size_t buffer_len, size_t arity, size_t key_size,
+                       size_t payload_size, int (*cmp_fn)(void *left, void *right)) {
+    if (!heap || !array || !key_size || !cmp_fn) return false;
+    if (arity != 2 && arity != 4 && arity != 8) return false;
+
+    const size_t padding = (arity - 1) * key_size;
+    if (buffer_len <= padding) return false;
+
+    const size_t capacity = (buffer_len - padding) / (key_size + payload_size);
+    if (!capacity) return false;
+
+    *heap = (emblib_dheap_t) {
+            .keys         = array,
+            .payloads     = payload_size ? (char *) array + padding + capacity * key_size : NULL,
+            .capacity     = capacity,
+            .count        = 0,
+            .arity        = arity,
+            .key_size     = key_size,
+            .payload_size = payload_size,
+            .cmp_fn       = cmp_fn
+    };
+    return true;
+}
+
+bool emblib_dheap_push(emblib_dheap_t *heap, void *key, void *payload) {
+    if (!heap || !key || (heap->payload_size && !payload) || emblib_dheap_is_full(heap)) return false;
+
+    size_t index = heap->count;
+    while (index > 0) {
+        const size_t parent = (index - 1) / heap->arity;
+        if (heap->cmp_fn(key, dheap_key(heap, parent)) <= 0) break;
+        dheap_move(heap, index, parent);
+        index = parent;
+    }
+    dheap_put(heap, index, key, payload);
+    heap->count++;
+    return true;
+}
+
+bool emblib_dheap_pop(emblib_dheap_t *heap, void *key, void *payload) {
+    if (!emblib_dheap_peek(heap, key, payload)) return false;
+
+    heap->count--;
+    if (!heap->count) return true;
+
+    char last_key[heap->key_size];
+    char last_payload[heap->payload_size ? heap->payload_size : 1];
+    memcpy(last_key, dheap_key(heap, heap->count), heap->key_size);
+    if (heap->payload_size) memcpy(last_payload, dheap_payload(heap, heap->count), heap->payload_size);
+
+    size_t index = 0;
+    for (;;) {
+        const size_t first = index * heap->arity + 1;
+        if (first >= heap->count) break;
+
+        // best of the children, which are contiguous keys
+        const size_t end = first + heap->arity < heap->count ? first + heap->arity : heap->count;
+        size_t best = first;
+        for (size_t child = first + 1; child < end; child++) {
+            if (heap->cmp_fn(dheap_key(heap, child), dheap_key(heap, best)) > 0) best = child;
+        }
+        if (heap->cmp_fn(dheap_key(heap, best), last_key) <= 0) break;
+
+        dheap_move(heap, index, best);
+        index = best;
+    }
+    dheap_put(heap, index, last_key, last_payload);
+    return true;
+}
+
+bool emblib_dheap_peek(emblib_dheap_t *heap, void *key, void *payload) {
+    if (!heap || emblib_dheap_is_empty(heap)) return false;
+
+    if (key) memcpy(key, dheap_key(heap, 0), heap->key_size);
+    if (payload && heap->payload_size) memcpy(payload, dheap_payload(heap, 0), heap->payload_size);
+    return true;
+}
+
+size_t emblib_dheap_size(emblib_dheap_t *heap) {
+    return heap ? heap->capacity : 0;
+}
+
+size_t emblib_dheap_count(emblib_dheap_t *heap) {
+    return heap ? heap->count : 0;
+}
+
+void emblib_dheap_flush(emblib_dheap_t *heap) {
+    if (heap) heap->count = 0;
+}
+
+bool emblib_dheap_is_full(emblib_dheap_t *heap) {
+    return heap ? heap->count >= heap->capacity : false;
+}
+
+bool emblib_dheap_is_empty(emblib_dheap_t *heap) {
+    return heap ? heap->count == 0 : false;
+}
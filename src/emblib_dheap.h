@@ -0,0 +1,112 @@
+#ifndef __EMB_LIB_EMBLIB_DHEAP_H__
+#define __EMB_LIB_EMBLIB_DHEAP_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief d-ary heap (d = 2, 4 or 8) with the keys stored apart from the payloads.
+ *        Sifting compares keys only, so the keys of a level stay dense in cache; the payloads
+ *        just follow their key. The key array starts with d - 1 unused slots so that the d
+ *        children of a node start on a multiple of d: with the buffer aligned on 64 bytes and
+ *        d * key_size == 64 (8 keys of 8 bytes, 4 of 16), the children of a node share one cache
+ *        line. A 4-ary heap is half as deep as a binary one.
+ *        The caller buffer holds the keys followed by the payloads.
+ */
+typedef struct _emblib_dheap_t {
+    void *keys;             //!< keys, starting d - 1 slots before the root
+    void *payloads;         //!< payloads, NULL when payload_size is 0
+    size_t capacity;        //!< maximum number of elements
+    size_t count;           //!< number of elements stored
+    size_t arity;           //!< children per node
+    size_t key_size;        //!< size of a key
+    size_t payload_size;    //!< size of a payload, may be 0
+    int (*cmp_fn)(void *left, void *right); //! key compare function, > 0 when left has the higher priority
+} emblib_dheap_t;
+
+/**
+ * @brief Initializes the heap.
+ *
+ * @param[in,out] heap Pointer to the heap structure.
+ * @param[in] array Pointer to the memory of the heap, aligned on 64 bytes for the cache line layout.
+ * @param[in] buffer_len Size in bytes of array.
+ * @param[in] arity Children per node: 2, 4 or 8.
+ * @param[in] key_size Size of a key in bytes.
+ * @param[in] payload_size Size of a payload in bytes, 0 for keys only.
+ * @param[in] cmp_fn Key compare function, > 0 when left has the higher priority.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_dheap_init(emblib_dheap_t *heap, void *array, size_t buffer_len, size_t arity, size_t key_size,
+                       size_t payload_size, int (*cmp_fn)(void *left, void *right));
+
+/**
+ * @brief Pushes an element, O(log_d n).
+ *
+ * @param[in,out] heap Pointer to the heap structure.
+ * @param[in] key Pointer to the key.
+ * @param[in] payload Pointer to the payload, ignored when payload_size is 0.
+ * @return true if the push is successful, false if the heap is full.
+ */
+bool emblib_dheap_push(emblib_dheap_t *heap, void *key, void *payload);
+
+/**
+ * @brief Pops the element with the highest priority, O(d log_d n).
+ *
+ * @param[in,out] heap Pointer to the heap structure.
+ * @param[out] key Pointer to the memory for the key, may be NULL.
+ * @param[out] payload Pointer to the memory for the payload, may be NULL.
+ * @return true if the pop is successful, false if the heap is empty.
+ */
+bool emblib_dheap_pop(emblib_dheap_t *heap, void *key, void *payload);
+
+/**
+ * @brief Peeks the element with the highest priority, O(1).
+ *
+ * @param[in] heap Pointer to the heap structure.
+ * @param[out] key Pointer to the memory for the key, may be NULL.
+ * @param[out] payload Pointer to the memory for the payload, may be NULL.
+ * @return true if the peek is successful, false if the heap is empty.
+ */
+bool emblib_dheap_peek(emblib_dheap_t *heap, void *key, void *payload);
+
+/**
+ * @brief Returns the maximum number of elements of the heap.
+ *
+ * @param[in] heap Pointer to the heap structure.
+ * @return Maximum number of elements.
+ */
+size_t emblib_dheap_size(emblib_dheap_t *heap);
+
+/**
+ * @brief Returns the number of elements currently stored in the heap.
+ *
+ * @param[in] heap Pointer to the heap structure.
+ * @return Number of elements in the heap.
+ */
+size_t emblib_dheap_count(emblib_dheap_t *heap);
+
+/**
+ * @brief Clears all elements from the heap.
+ *
+ * @param[in,out] heap Pointer to the heap structure.
+ */
+void emblib_dheap_flush(emblib_dheap_t *heap);
+
+/**
+ * @brief Checks if the heap is full.
+ *
+ * @param[in] heap Pointer to the heap structure.
+ * @return true if no more element can be pushed, false otherwise.
+ */
+bool emblib_dheap_is_full(emblib_dheap_t *heap);
+
+/**
+ * @brief Checks if the heap is empty.
+ *
+ * @param[in] heap Pointer to the heap structure.
+ * @return true if the heap holds no element, false otherwise.
+ */
+bool emblib_dheap_is_empty(emblib_dheap_t *heap);
+
+#endif //__EMB_LIB_EMBLIB_DHEAP_H__
@@ -0,0 +1,77 @@
+#include "emblib_hash.h"
+
+uint64_t emblib_hash64(const void *data, size_t len, uint64_t seed) {
+    const uint8_t *p = (const uint8_t *) data;
+    uint64_t a, b;
+
+    seed = emblib_hash_seed(seed);
+    if (len <= 16) {
+        if (len >= 4) {
+            const size_t mid = (len >> 3) << 2;
+            a = (emblib_hash_read32(p) << 32) | emblib_hash_read32(p + mid);
+            b = (emblib_hash_read32(p + len - 4) << 32) | emblib_hash_read32(p + len - 4 - mid);
+        } else if (len > 0) {
+            a = ((uint64_t) p[0] << 16) | ((uint64_t) p[len >> 1] << 8) | p[len - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = len;
+        if (i > 48) {
+            // three independent lanes per 48 bytes
+            uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = emblib_hash_mix(emblib_hash_read64(p) ^ EMBLIB_HASH_SECRET1, emblib_hash_read64(p + 8) ^ seed);
+                see1 = emblib_hash_mix(emblib_hash_read64(p + 16) ^ EMBLIB_HASH_SECRET2,
+                                       emblib_hash_read64(p + 24) ^ see1);
+                see2 = emblib_hash_mix(emblib_hash_read64(p + 32) ^ EMBLIB_HASH_SECRET3,
+                                       emblib_hash_read64(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = emblib_hash_mix(emblib_hash_read64(p) ^ EMBLIB_HASH_SECRET1, emblib_hash_read64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        // the last 16 bytes, overlapping the previous block if needed
+        a = emblib_hash_read64(p + i - 16);
+        b = emblib_hash_read64(p + i - 8);
+    }
+    return emblib_hash_final(a, b, seed, len);
+}
+
+void emblib_hash_many(const void *data, size_t count, size_t elem_size, uint64_t seed, uint64_t *out) {
+    if (!data || !out) return;
+
+    const uint8_t *p = (const uint8_t *) data;
+    switch (elem_size) {
+        case 4:
+            for (size_t i = 0; i < count; i++) out[i] = emblib_hash32_key(p + i * 4, seed);
+            break;
+        case 8:
+            for (size_t i = 0; i < count; i++) out[i] = emblib_hash64_key(p + i * 8, seed);
+            break;
+        case 16:
+            for (size_t i = 0; i < count; i++) out[i] = emblib_hash128_key(p + i * 16, seed);
+            break;
+        default:
+            for (size_t i = 0; i < count; i++) out[i] = emblib_hash64(p + i * elem_size, elem_size, seed);
+            break;
+    }
+}
+
+uint64_t emblib_hash_fn_32(void *data) {
+    return emblib_hash32_key(data, 0);
+}
+
+uint64_t emblib_hash_fn_64(void *data) {
+    return emblib_hash64_key(data, 0);
+}
+
+uint64_t emblib_hash_fn_128(void *data) {
+    return emblib_hash128_key(data, 0);
+}
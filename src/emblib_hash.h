@@ -0,0 +1,127 @@
+#ifndef __EMB_LIB_EMBLIB_HASH_H__
+#define __EMB_LIB_EMBLIB_HASH_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Fast non-cryptographic 64-bit hashing (wyhash construction: 64x64->128 bit multiply
+ *        and fold). Not suited to untrusted keys chosen to collide. Results are for hash tables
+ *        in the same process: they depend on the byte order of the target.
+ *
+ *        The fixed-size helpers return the same value as emblib_hash64 over the same bytes.
+ */
+
+#define EMBLIB_HASH_SECRET0 0x2d358dccaa6c78a5ull
+#define EMBLIB_HASH_SECRET1 0x8bb84b93962eacc9ull
+#define EMBLIB_HASH_SECRET2 0x4b33a62ed433d4a3ull
+#define EMBLIB_HASH_SECRET3 0x4d5a2da51de1aa47ull
+
+/**
+ * @brief 128-bit product of a and b: low half in a, high half in b
+ */
+static inline void emblib_hash_mum(uint64_t *a, uint64_t *b) {
+#if defined(__SIZEOF_INT128__)
+    const __uint128_t r = (__uint128_t) *a * *b;
+    *a = (uint64_t) r;
+    *b = (uint64_t) (r >> 64);
+#else
+    const uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t) *a, lb = (uint32_t) *b;
+    const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const uint64_t t = rl + (rm0 << 32);
+    const uint64_t lo = t + (rm1 << 32);
+    const uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl) + (lo < t);
+    *a = lo;
+    *b = hi;
+#endif
+}
+
+static inline uint64_t emblib_hash_mix(uint64_t a, uint64_t b) {
+    emblib_hash_mum(&a, &b);
+    return a ^ b;
+}
+
+static inline uint64_t emblib_hash_read64(const uint8_t *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t emblib_hash_read32(const uint8_t *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t emblib_hash_seed(uint64_t seed) {
+    return seed ^ emblib_hash_mix(seed ^ EMBLIB_HASH_SECRET0, EMBLIB_HASH_SECRET1);
+}
+
+static inline uint64_t emblib_hash_final(uint64_t a, uint64_t b, uint64_t seed, size_t len) {
+    a ^= EMBLIB_HASH_SECRET1;
+    b ^= seed;
+    emblib_hash_mum(&a, &b);
+    return emblib_hash_mix(a ^ EMBLIB_HASH_SECRET0 ^ len, b ^ EMBLIB_HASH_SECRET1);
+}
+
+/**
+ * @brief Hashes len bytes.
+ *
+ * @param data Pointer to the bytes, no alignment required.
+ * @param len Number of bytes.
+ * @param seed Seed, different seeds give independent hash functions.
+ * @return 64-bit hash.
+ */
+uint64_t emblib_hash64(const void *data, size_t len, uint64_t seed);
+
+/**
+ * @brief Hashes a 4-byte key (same result as emblib_hash64(data, 4, seed)).
+ */
+static inline uint64_t emblib_hash32_key(const void *data, uint64_t seed) {
+    const uint64_t v = emblib_hash_read32((const uint8_t *) data);
+    return emblib_hash_final((v << 32) | v, (v << 32) | v, emblib_hash_seed(seed), 4);
+}
+
+/**
+ * @brief Hashes an 8-byte key (same result as emblib_hash64(data, 8, seed)).
+ */
+static inline uint64_t emblib_hash64_key(const void *data, uint64_t seed) {
+    const uint8_t *p = (const uint8_t *) data;
+    const uint64_t lo = emblib_hash_read32(p), hi = emblib_hash_read32(p + 4);
+    return emblib_hash_final((lo << 32) | hi, (hi << 32) | lo, emblib_hash_seed(seed), 8);
+}
+
+/**
+ * @brief Hashes a 16-byte key (same result as emblib_hash64(data, 16, seed)).
+ */
+static inline uint64_t emblib_hash128_key(const void *data, uint64_t seed) {
+    const uint8_t *p = (const uint8_t *) data;
+    return emblib_hash_final((emblib_hash_read32(p) << 32) | emblib_hash_read32(p + 8),
+                             (emblib_hash_read32(p + 12) << 32) | emblib_hash_read32(p + 4),
+                             emblib_hash_seed(seed), 16);
+}
+
+/**
+ * @brief Hashes count consecutive elements of elem_size bytes into out, with the inline
+ *        path for 4, 8 and 16-byte elements.
+ *
+ * @param data Pointer to the elements.
+ * @param count Number of elements.
+ * @param elem_size Size of each element in bytes.
+ * @param seed Seed.
+ * @param out Array of count hashes.
+ */
+void emblib_hash_many(const void *data, size_t count, size_t elem_size, uint64_t seed, uint64_t *out);
+
+/**
+ * @brief Hash callbacks with seed 0 for the hash containers (hash_fn of emblib_hash_set_t,
+ *        emblib_swiss_set_t, emblib_map_t...) over 4, 8 and 16-byte elements.
+ */
+uint64_t emblib_hash_fn_32(void *data);
+
+uint64_t emblib_hash_fn_64(void *data);
+
+uint64_t emblib_hash_fn_128(void *data);
+
+#endif //__EMB_LIB_EMBLIB_HASH_H__
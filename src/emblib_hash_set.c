@@ -0,0 +1,111 @@
+#include "emblib_hash_set.h"
+#include "emblib_robin_hood.h"
+#include <string.h>
+
+static emblib_robin_hood_t hash_set_table(emblib_hash_set_t *set) {
+    return (emblib_robin_hood_t) {
+            .array     = (char *) set->array,
+            .dist      = set->dist,
+            .mask      = set->capacity - 1,
+            .slot_size = set->elem_size
+    };
+}
+
+static bool hash_set_match(void *ctx, void *slot, void *data) {
+    return ((emblib_hash_set_t *) ctx)->cmp_fn(slot, data) == 0;
+}
+
+/**
+ * @brief look for data; on a miss, pos and dist receive the slot where data belongs
+ */
+static bool hash_set_find(emblib_hash_set_t *set, void *data, size_t *pos, size_t *dist) {
+    const emblib_robin_hood_t table = hash_set_table(set);
+    return emblib_robin_hood_find(&table, set->hash_fn(data), hash_set_match, set, data, pos, dist);
+}
+
+bool emblib_hash_set_init(emblib_hash_set_t *set, void *array, size_t buffer_len, size_t size_elem,
+                          void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
+                          int (*cmp_fn)(void *right, void *left), uint64_t (*hash_fn)(void *data)) {
+    if (!set || !array || !size_elem || !copy_fn || !cmp_fn || !hash_fn) return false;
+
+    size_t capacity = 1;
+    while (capacity * 2 <= buffer_len / (size_elem + 1)) {
+        capacity *= 2;
+    }
+    if (capacity * (size_elem + 1) > buffer_len || capacity < 2) return false;
+
+    *set = (emblib_hash_set_t) {
+            .array     = array,
+            .dist      = (uint8_t *) array + capacity * size_elem,
+            .capacity  = capacity,
+            .max_count = capacity - (capacity >= 8 ? capacity / 8 : 1),
+            .count     = 0,
+            .elem_size = size_elem,
+            .copy_fn   = copy_fn,
+            .free_fn   = free_fn,
+            .cmp_fn    = cmp_fn,
+            .hash_fn   = hash_fn
+    };
+    memset(set->dist, 0, capacity);
+    return true;
+}
+
+bool emblib_hash_set_add(emblib_hash_set_t *set, void *data) {
+    if (!set || !data || emblib_hash_set_is_full(set)) return false;
+
+    size_t pos, dist;
+    if (hash_set_find(set, data, &pos, &dist) || dist > EMBLIB_ROBIN_HOOD_MAX_DIST) return false;
+
+    const emblib_robin_hood_t table = hash_set_table(set);
+    if (!emblib_robin_hood_make_room(&table, pos)) return false;
+
+    set->copy_fn(emblib_robin_hood_slot(&table, pos), data);
+    set->dist[pos] = (uint8_t) dist;
+    set->count++;
+    return true;
+}
+
+bool emblib_hash_set_remove(emblib_hash_set_t *set, void *data) {
+    if (!set || !data || !set->count) return false;
+
+    size_t pos, dist;
+    if (!hash_set_find(set, data, &pos, &dist)) return false;
+
+    const emblib_robin_hood_t table = hash_set_table(set);
+    emblib_robin_hood_erase(&table, pos);
+    set->count--;
+    return true;
+}
+
+bool emblib_hash_set_contains(emblib_hash_set_t *set, void *data) {
+    if (!set || !data || !set->count) return false;
+
+    size_t pos, dist;
+    return hash_set_find(set, data, &pos, &dist);
+}
+
+size_t emblib_hash_set_size(emblib_hash_set_t *set) {
+    return set ? set->max_count : 0;
+}
+
+size_t emblib_hash_set_count(emblib_hash_set_t *set) {
+    return set ? set->count : 0;
+}
+
+void emblib_hash_set_flush(emblib_hash_set_t *set) {
+    if (set) {
+        for (size_t i = 0; i < set->capacity && set->free_fn; i++) {
+            if (set->dist[i]) set->free_fn((char *) set->array + i * set->elem_size);
+        }
+        memset(set->dist, 0, set->capacity);
+        set->count = 0;
+    }
+}
+
+bool emblib_hash_set_is_full(emblib_hash_set_t *set) {
+    return set ? set->count >= set->max_count : false;
+}
+
+bool emblib_hash_set_is_empty(emblib_hash_set_t *set) {
+    return set ? set->count == 0 : false;
+}
@@ -0,0 +1,96 @@
+#ifndef __EMB_LIB_EMBLIB_HASH_SET_H__
+#define __EMB_LIB_EMBLIB_HASH_SET_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Open-addressing hash set (Robin Hood linear probing with backward-shift deletion)
+ *        over a caller buffer. The buffer holds the slots followed by one probe-distance
+ *        byte per slot; the number of slots is the largest power of two that fits.
+ */
+typedef struct _emblib_hash_set_t {
+    void *array;            //!< slots
+    uint8_t *dist;          //!< probe distance + 1 of each slot, 0 for an empty slot
+    size_t capacity;        //!< number of slots (power of two)
+    size_t max_count;       //!< maximum number of elements (7/8 of the slots)
+    size_t count;           //!< number of elements stored
+    size_t elem_size;       //!< size of each element
+    void (*copy_fn)(void *dest, void *src); //! copy function
+    void (*free_fn)(void *data);            //! free function
+    int (*cmp_fn)(void *right, void *left); //! compare function, 0 when equal
+    uint64_t (*hash_fn)(void *data);        //! hash function
+} emblib_hash_set_t;
+
+/**
+ * @brief Initializes the hash set.
+ *
+ * @param set Pointer to the hash set structure.
+ * @param array Pointer to the memory where elements will be stored.
+ * @param buffer_len Size in bytes of array.
+ * @param size_elem Size of each element in bytes.
+ * @param hash_fn Hash function. Equal elements must have the same hash.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_hash_set_init(emblib_hash_set_t *set, void *array, size_t buffer_len, size_t size_elem,
+                          void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
+                          int (*cmp_fn)(void *right, void *left), uint64_t (*hash_fn)(void *data));
+
+/**
+ * @brief Adds an element to the hash set. O(1) expected.
+ *
+ * @param set Pointer to the hash set structure.
+ * @param data Pointer to the element to be added.
+ * @return true if the add is successful, false if the element already exists, the set is full or
+ *         the element would land more than 255 slots away from its home slot (possible before
+ *         the set is full with a poor hash_fn; emblib_hash_set_contains tells a duplicate apart).
+ */
+bool emblib_hash_set_add(emblib_hash_set_t *set, void *data);
+
+/**
+ * @brief Removes an element from the hash set. O(1) expected.
+ *
+ * @param set Pointer to the hash set structure.
+ * @param data Pointer to the element to be removed.
+ * @return true if the remove is successful, false otherwise.
+ */
+bool emblib_hash_set_remove(emblib_hash_set_t *set, void *data);
+
+/**
+ * @brief Checks if the hash set contains a specific element. O(1) expected.
+ *
+ * @param set Pointer to the hash set structure.
+ * @param data Pointer to the element to check.
+ * @return true if the hash set contains the element, false otherwise.
+ */
+bool emblib_hash_set_contains(emblib_hash_set_t *set, void *data);
+
+/**
+ * @brief Returns the maximum number of elements of the hash set.
+ *
+ * @param set Pointer to the hash set structure.
+ * @return Maximum number of elements.
+ */
+size_t emblib_hash_set_size(emblib_hash_set_t *set);
+
+/**
+ * @brief Returns the number of elements currently stored in the hash set.
+ *
+ * @param set Pointer to the hash set structure.
+ * @return Number of elements in the hash set.
+ */
+size_t emblib_hash_set_count(emblib_hash_set_t *set);
+
+/**
+ * @brief Clears all elements from the hash set.
+ *
+ * @param set Pointer to the hash set structure.
+ */
+void emblib_hash_set_flush(emblib_hash_set_t *set);
+
+bool emblib_hash_set_is_full(emblib_hash_set_t *set);
+
+bool emblib_hash_set_is_empty(emblib_hash_set_t *set);
+
+#endif //__EMB_LIB_EMBLIB_HASH_SET_H__
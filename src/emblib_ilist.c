@@ -0,0 +1,201 @@
+#include "emblib_ilist.h"
+
+static emblib_ilist_node_t *ilist_node(emblib_ilist_pool_t *pool, emblib_ilist_index_t handle) {
+    return (emblib_ilist_node_t *) ((char *) pool->array + (size_t) handle * pool->elem_size + pool->node_offset);
+}
+
+static bool ilist_valid(emblib_ilist_pool_t *pool, emblib_ilist_index_t handle) {
+    return pool && handle != EMBLIB_ILIST_NIL && (size_t) handle < pool->capacity;
+}
+
+bool emblib_ilist_pool_init(emblib_ilist_pool_t *pool, void *array, size_t buffer_len, size_t size_elem,
+                            size_t node_offset) {
+    if (!pool || !array || !size_elem || (buffer_len % size_elem) ||
+        (node_offset + sizeof(emblib_ilist_node_t) > size_elem)) {
+        return false;
+    }
+
+    const size_t capacity = buffer_len / size_elem;
+    if (!capacity || capacity >= (size_t) EMBLIB_ILIST_NIL) return false;
+
+    *pool = (emblib_ilist_pool_t) {
+            .array       = array,
+            .capacity    = capacity,
+            .elem_size   = size_elem,
+            .node_offset = node_offset,
+            .free_count  = capacity,
+            .free_head   = 0
+    };
+
+    for (size_t i = 0; i < capacity; i++) {
+        emblib_ilist_node_t *node = ilist_node(pool, (emblib_ilist_index_t) i);
+        node->prev = EMBLIB_ILIST_NIL;
+        node->next = (i + 1 < capacity) ? (emblib_ilist_index_t) (i + 1) : EMBLIB_ILIST_NIL;
+    }
+    return true;
+}
+
+emblib_ilist_index_t emblib_ilist_pool_alloc(emblib_ilist_pool_t *pool) {
+    if (!pool || pool->free_head == EMBLIB_ILIST_NIL) return EMBLIB_ILIST_NIL;
+
+    const emblib_ilist_index_t handle = pool->free_head;
+    emblib_ilist_node_t *node = ilist_node(pool, handle);
+    pool->free_head = node->next;
+    pool->free_count--;
+
+    node->prev = node->next = EMBLIB_ILIST_NIL;
+    return handle;
+}
+
+void emblib_ilist_pool_free(emblib_ilist_pool_t *pool, emblib_ilist_index_t handle) {
+    if (!ilist_valid(pool, handle)) return;
+
+    emblib_ilist_node_t *node = ilist_node(pool, handle);
+    node->prev = EMBLIB_ILIST_NIL;
+    node->next = pool->free_head;
+    pool->free_head = handle;
+    pool->free_count++;
+}
+
+size_t emblib_ilist_pool_available(emblib_ilist_pool_t *pool) {
+    return pool ? pool->free_count : 0;
+}
+
+void *emblib_ilist_pool_elem(emblib_ilist_pool_t *pool, emblib_ilist_index_t handle) {
+    return ilist_valid(pool, handle) ? (char *) pool->array + (size_t) handle * pool->elem_size : NULL;
+}
+
+emblib_ilist_index_t emblib_ilist_pool_handle(emblib_ilist_pool_t *pool, const void *elem) {
+    if (!pool || (const char *) elem < (const char *) pool->array) return EMBLIB_ILIST_NIL;
+
+    const size_t offset = (size_t) ((const char *) elem - (const char *) pool->array);
+    if ((offset % pool->elem_size) || (offset / pool->elem_size) >= pool->capacity) return EMBLIB_ILIST_NIL;
+
+    return (emblib_ilist_index_t) (offset / pool->elem_size);
+}
+
+bool emblib_ilist_init(emblib_ilist_t *list, emblib_ilist_pool_t *pool) {
+    if (!list || !pool) return false;
+
+    *list = (emblib_ilist_t) {
+            .pool  = pool,
+            .head  = EMBLIB_ILIST_NIL,
+            .tail  = EMBLIB_ILIST_NIL,
+            .count = 0
+    };
+    return true;
+}
+
+bool emblib_ilist_push_front(emblib_ilist_t *list, emblib_ilist_index_t handle) {
+    return list ? emblib_ilist_insert_before(list, list->head, handle) : false;
+}
+
+bool emblib_ilist_push_back(emblib_ilist_t *list, emblib_ilist_index_t handle) {
+    return emblib_ilist_insert_before(list, EMBLIB_ILIST_NIL, handle);
+}
+
+bool emblib_ilist_insert_before(emblib_ilist_t *list, emblib_ilist_index_t pos, emblib_ilist_index_t handle) {
+    if (!list || !ilist_valid(list->pool, handle)) return false;
+    if (pos != EMBLIB_ILIST_NIL && !ilist_valid(list->pool, pos)) return false;
+
+    emblib_ilist_node_t *node = ilist_node(list->pool, handle);
+    const emblib_ilist_index_t prev = (pos == EMBLIB_ILIST_NIL) ? list->tail : ilist_node(list->pool, pos)->prev;
+
+    node->prev = prev;
+    node->next = pos;
+
+    if (prev == EMBLIB_ILIST_NIL) list->head = handle;
+    else ilist_node(list->pool, prev)->next = handle;
+
+    if (pos == EMBLIB_ILIST_NIL) list->tail = handle;
+    else ilist_node(list->pool, pos)->prev = handle;
+
+    list->count++;
+    return true;
+}
+
+bool emblib_ilist_insert_after(emblib_ilist_t *list, emblib_ilist_index_t pos, emblib_ilist_index_t handle) {
+    if (!list) return false;
+    if (pos == EMBLIB_ILIST_NIL) return emblib_ilist_insert_before(list, list->head, handle);
+    if (!ilist_valid(list->pool, pos)) return false;
+
+    return emblib_ilist_insert_before(list, ilist_node(list->pool, pos)->next, handle);
+}
+
+bool emblib_ilist_remove(emblib_ilist_t *list, emblib_ilist_index_t handle) {
+    if (!list || !list->count || !ilist_valid(list->pool, handle)) return false;
+
+    emblib_ilist_node_t *node = ilist_node(list->pool, handle);
+
+    if (node->prev == EMBLIB_ILIST_NIL) list->head = node->next;
+    else ilist_node(list->pool, node->prev)->next = node->next;
+
+    if (node->next == EMBLIB_ILIST_NIL) list->tail = node->prev;
+    else ilist_node(list->pool, node->next)->prev = node->prev;
+
+    node->prev = node->next = EMBLIB_ILIST_NIL;
+    list->count--;
+    return true;
+}
+
+bool emblib_ilist_splice(emblib_ilist_t *dst, emblib_ilist_index_t pos, emblib_ilist_t *src) {
+    if (!dst || !src || dst == src || dst->pool != src->pool) return false;
+    if (pos != EMBLIB_ILIST_NIL && !ilist_valid(dst->pool, pos)) return false;
+    if (!src->count) return true;
+
+    emblib_ilist_pool_t *pool = dst->pool;
+    const emblib_ilist_index_t prev = (pos == EMBLIB_ILIST_NIL) ? dst->tail : ilist_node(pool, pos)->prev;
+
+    ilist_node(pool, src->head)->prev = prev;
+    ilist_node(pool, src->tail)->next = pos;
+
+    if (prev == EMBLIB_ILIST_NIL) dst->head = src->head;
+    else ilist_node(pool, prev)->next = src->head;
+
+    if (pos == EMBLIB_ILIST_NIL) dst->tail = src->tail;
+    else ilist_node(pool, pos)->prev = src->tail;
+
+    dst->count += src->count;
+
+    src->head = src->tail = EMBLIB_ILIST_NIL;
+    src->count = 0;
+    return true;
+}
+
+void emblib_ilist_flush(emblib_ilist_t *list) {
+    if (!list || !list->count) return;
+
+    emblib_ilist_pool_t *pool = list->pool;
+
+    // the free list is singly linked through next, so the whole chain goes back at once
+    ilist_node(pool, list->tail)->next = pool->free_head;
+    pool->free_head = list->head;
+    pool->free_count += list->count;
+
+    list->head = list->tail = EMBLIB_ILIST_NIL;
+    list->count = 0;
+}
+
+emblib_ilist_index_t emblib_ilist_front(emblib_ilist_t *list) {
+    return list ? list->head : EMBLIB_ILIST_NIL;
+}
+
+emblib_ilist_index_t emblib_ilist_back(emblib_ilist_t *list) {
+    return list ? list->tail : EMBLIB_ILIST_NIL;
+}
+
+emblib_ilist_index_t emblib_ilist_next(emblib_ilist_t *list, emblib_ilist_index_t handle) {
+    return (list && ilist_valid(list->pool, handle)) ? ilist_node(list->pool, handle)->next : EMBLIB_ILIST_NIL;
+}
+
+emblib_ilist_index_t emblib_ilist_prev(emblib_ilist_t *list, emblib_ilist_index_t handle) {
+    return (list && ilist_valid(list->pool, handle)) ? ilist_node(list->pool, handle)->prev : EMBLIB_ILIST_NIL;
+}
+
+size_t emblib_ilist_count(emblib_ilist_t *list) {
+    return list ? list->count : 0;
+}
+
+bool emblib_ilist_is_empty(emblib_ilist_t *list) {
+    return list ? list->count == 0 : false;
+}
@@ -0,0 +1,232 @@
+#ifndef __EMBLIB_ILIST_H__
+#define __EMBLIB_ILIST_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Index type used to link the nodes. Define EMBLIB_ILIST_INDEX_16 to
+ *        use 16-bit links (pools up to 65535 nodes).
+ */
+#ifdef EMBLIB_ILIST_INDEX_16
+typedef uint16_t emblib_ilist_index_t;
+#else
+typedef uint32_t emblib_ilist_index_t;
+#endif
+
+//! invalid handle / end of list marker
+#define EMBLIB_ILIST_NIL ((emblib_ilist_index_t) -1)
+
+/**
+ * @brief Link fields embedded into the user element.
+ */
+typedef struct emblib_ilist_node_t {
+    emblib_ilist_index_t prev;  //!< handle of the previous node
+    emblib_ilist_index_t next;  //!< handle of the next node
+} emblib_ilist_node_t;
+
+/**
+ * @brief Pool of elements living in a caller array. Elements never move, so
+ *        a handle (the element index into the array) and the element address
+ *        stay valid until the element is released.
+ */
+typedef struct emblib_ilist_pool_t {
+    void *array;                        //!< array pointer elements
+    size_t capacity;                    //!< number of elements of the pool
+    size_t elem_size;                   //!< size of each element
+    size_t node_offset;                 //!< offset of the emblib_ilist_node_t inside the element
+    size_t free_count;                  //!< number of elements available
+    emblib_ilist_index_t free_head;     //!< head of the free list
+} emblib_ilist_pool_t;
+
+/**
+ * @brief Doubly-linked list of elements allocated from an emblib_ilist_pool_t.
+ *        Several lists can share the same pool.
+ */
+typedef struct emblib_ilist_t {
+    emblib_ilist_pool_t *pool;          //!< pool where the nodes live
+    emblib_ilist_index_t head;          //!< handle of the first node
+    emblib_ilist_index_t tail;          //!< handle of the last node
+    size_t count;                       //!< number of nodes linked
+} emblib_ilist_t;
+
+/**
+ * @brief Initializes the pool. All the elements are put into the free list.
+ *
+ * @param[in,out] pool Pointer to the pool structure.
+ * @param[in] array Pointer to the memory where elements will be stored.
+ * @param[in] buffer_len Size in bytes of array.
+ * @param[in] size_elem Size of each element in bytes.
+ * @param[in] node_offset Offset of the emblib_ilist_node_t member inside the element (use offsetof).
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_ilist_pool_init(emblib_ilist_pool_t *pool, void *array, size_t buffer_len, size_t size_elem,
+                            size_t node_offset);
+
+/**
+ * @brief Takes an element from the pool.
+ *
+ * @param[in,out] pool Pointer to the pool structure.
+ * @return handle of the element, EMBLIB_ILIST_NIL if the pool is exhausted.
+ */
+emblib_ilist_index_t emblib_ilist_pool_alloc(emblib_ilist_pool_t *pool);
+
+/**
+ * @brief Gives an element back to the pool. The element must not be linked into a list.
+ *
+ * @param[in,out] pool Pointer to the pool structure.
+ * @param[in] handle Handle of the element.
+ */
+void emblib_ilist_pool_free(emblib_ilist_pool_t *pool, emblib_ilist_index_t handle);
+
+/**
+ * @brief Returns the number of elements still available into the pool.
+ *
+ * @param[in] pool Pointer to the pool structure.
+ * @return number of free elements.
+ */
+size_t emblib_ilist_pool_available(emblib_ilist_pool_t *pool);
+
+/**
+ * @brief Returns the address of an element.
+ *
+ * @param[in] pool Pointer to the pool structure.
+ * @param[in] handle Handle of the element.
+ * @return element address, NULL for an invalid handle.
+ */
+void *emblib_ilist_pool_elem(emblib_ilist_pool_t *pool, emblib_ilist_index_t handle);
+
+/**
+ * @brief Returns the handle of an element from its address.
+ *
+ * @param[in] pool Pointer to the pool structure.
+ * @param[in] elem Element address.
+ * @return handle of the element, EMBLIB_ILIST_NIL if elem does not belong to the pool.
+ */
+emblib_ilist_index_t emblib_ilist_pool_handle(emblib_ilist_pool_t *pool, const void *elem);
+
+/**
+ * @brief Initializes an empty list over a pool.
+ *
+ * @param[in,out] list Pointer to the list structure.
+ * @param[in] pool Pointer to the pool structure.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_ilist_init(emblib_ilist_t *list, emblib_ilist_pool_t *pool);
+
+/**
+ * @brief Links a node at the front of the list. O(1).
+ *
+ * @param[in,out] list Pointer to the list structure.
+ * @param[in] handle Handle of an unlinked element.
+ * @return true on success, false otherwise.
+ */
+bool emblib_ilist_push_front(emblib_ilist_t *list, emblib_ilist_index_t handle);
+
+/**
+ * @brief Links a node at the back of the list. O(1).
+ *
+ * @param[in,out] list Pointer to the list structure.
+ * @param[in] handle Handle of an unlinked element.
+ * @return true on success, false otherwise.
+ */
+bool emblib_ilist_push_back(emblib_ilist_t *list, emblib_ilist_index_t handle);
+
+/**
+ * @brief Links a node before another one. O(1).
+ *
+ * @param[in,out] list Pointer to the list structure.
+ * @param[in] pos Handle of a node of the list, EMBLIB_ILIST_NIL to link at the back.
+ * @param[in] handle Handle of an unlinked element.
+ * @return true on success, false otherwise.
+ */
+bool emblib_ilist_insert_before(emblib_ilist_t *list, emblib_ilist_index_t pos, emblib_ilist_index_t handle);
+
+/**
+ * @brief Links a node after another one. O(1).
+ *
+ * @param[in,out] list Pointer to the list structure.
+ * @param[in] pos Handle of a node of the list, EMBLIB_ILIST_NIL to link at the front.
+ * @param[in] handle Handle of an unlinked element.
+ * @return true on success, false otherwise.
+ */
+bool emblib_ilist_insert_after(emblib_ilist_t *list, emblib_ilist_index_t pos, emblib_ilist_index_t handle);
+
+/**
+ * @brief Unlinks a node from the list. The element is not released to the pool. O(1).
+ *
+ * @param[in,out] list Pointer to the list structure.
+ * @param[in] handle Handle of a node of the list.
+ * @return true on success, false otherwise.
+ */
+bool emblib_ilist_remove(emblib_ilist_t *list, emblib_ilist_index_t handle);
+
+/**
+ * @brief Moves all the nodes of src before pos into dst. src becomes empty. O(1).
+ *
+ * @param[in,out] dst Pointer to the destination list.
+ * @param[in] pos Handle of a node of dst, EMBLIB_ILIST_NIL to append at the back.
+ * @param[in,out] src Pointer to the source list. Must share the pool with dst.
+ * @return true on success, false otherwise.
+ */
+bool emblib_ilist_splice(emblib_ilist_t *dst, emblib_ilist_index_t pos, emblib_ilist_t *src);
+
+/**
+ * @brief Unlinks all the nodes and gives them back to the pool. O(1).
+ *
+ * @param[in,out] list Pointer to the list structure.
+ */
+void emblib_ilist_flush(emblib_ilist_t *list);
+
+/**
+ * @brief Returns the handle of the first node.
+ *
+ * @param[in] list Pointer to the list structure.
+ * @return handle of the first node, EMBLIB_ILIST_NIL on empty list.
+ */
+emblib_ilist_index_t emblib_ilist_front(emblib_ilist_t *list);
+
+/**
+ * @brief Returns the handle of the last node.
+ *
+ * @param[in] list Pointer to the list structure.
+ * @return handle of the last node, EMBLIB_ILIST_NIL on empty list.
+ */
+emblib_ilist_index_t emblib_ilist_back(emblib_ilist_t *list);
+
+/**
+ * @brief Returns the handle of the node following handle.
+ *
+ * @param[in] list Pointer to the list structure.
+ * @param[in] handle Handle of a node of the list.
+ * @return handle of the next node, EMBLIB_ILIST_NIL at the end of the list.
+ */
+emblib_ilist_index_t emblib_ilist_next(emblib_ilist_t *list, emblib_ilist_index_t handle);
+
+/**
+ * @brief Returns the handle of the node preceding handle.
+ *
+ * @param[in] list Pointer to the list structure.
+ * @param[in] handle Handle of a node of the list.
+ * @return handle of the previous node, EMBLIB_ILIST_NIL at the beginning of the list.
+ */
+emblib_ilist_index_t emblib_ilist_prev(emblib_ilist_t *list, emblib_ilist_index_t handle);
+
+/**
+ * @brief Returns the number of nodes linked into the list.
+ *
+ * @param[in] list Pointer to the list structure.
+ * @return Number of nodes in the list.
+ */
+size_t emblib_ilist_count(emblib_ilist_t *list);
+
+/**
+ * @brief Checks if the list is empty.
+ *
+ * @param[in] list Pointer to the list structure.
+ * @return true if the list is empty, false otherwise.
+ */
+bool emblib_ilist_is_empty(emblib_ilist_t *list);
+
+#endif //__EMBLIB_ILIST_H__
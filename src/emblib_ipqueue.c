@@ -0,0 +1,163 @@
+#include "emblib_ipqueue.h"
+#include <string.h>
+
+static void *ipqueue_key(emblib_ipqueue_t *pqueue, uint32_t handle) {
+    return (char *) pqueue->keys + (size_t) handle * pqueue->key_size;
+}
+
+static bool ipqueue_above(emblib_ipqueue_t *pqueue, size_t i, size_t j) {
+    return pqueue->cmp_fn(ipqueue_key(pqueue, pqueue->heap[i]), ipqueue_key(pqueue, pqueue->heap[j])) > 0;
+}
+
+static void ipqueue_set(emblib_ipqueue_t *pqueue, size_t index, uint32_t handle) {
+    pqueue->heap[index] = handle;
+    pqueue->pos[handle] = (uint32_t) index;
+}
+
+static void ipqueue_sift_up(emblib_ipqueue_t *pqueue, size_t index) {
+    const uint32_t handle = pqueue->heap[index];
+    void *key = ipqueue_key(pqueue, handle);
+
+    while (index > 0) {
+        const size_t parent = (index - 1) / 2;
+        if (pqueue->cmp_fn(key, ipqueue_key(pqueue, pqueue->heap[parent])) <= 0) break;
+        ipqueue_set(pqueue, index, pqueue->heap[parent]);
+        index = parent;
+    }
+    ipqueue_set(pqueue, index, handle);
+}
+
+static void ipqueue_sift_down(emblib_ipqueue_t *pqueue, size_t index) {
+    const uint32_t handle = pqueue->heap[index];
+    void *key = ipqueue_key(pqueue, handle);
+
+    for (;;) {
+        size_t child = 2 * index + 1;
+        if (child >= pqueue->count) break;
+        if (child + 1 < pqueue->count && ipqueue_above(pqueue, child + 1, child)) child++;
+        if (pqueue->cmp_fn(ipqueue_key(pqueue, pqueue->heap[child]), key) <= 0) break;
+        ipqueue_set(pqueue, index, pqueue->heap[child]);
+        index = child;
+    }
+    ipqueue_set(pqueue, index, handle);
+}
+
+/**
+ * @brief take the element at index out of the heap, the last one fills the hole
+ */
+static void ipqueue_delete_at(emblib_ipqueue_t *pqueue, size_t index) {
+    const uint32_t handle = pqueue->heap[index];
+    pqueue->count--;
+    pqueue->pos[handle] = EMBLIB_IPQUEUE_NIL;
+    if (index == pqueue->count) return;
+
+    ipqueue_set(pqueue, index, pqueue->heap[pqueue->count]);
+    if (index > 0 && ipqueue_above(pqueue, index, (index - 1) / 2)) {
+        ipqueue_sift_up(pqueue, index);
+    } else {
+        ipqueue_sift_down(pqueue, index);
+    }
+}
+
+bool emblib_ipqueue_init(emblib_ipqueue_t *pqueue, void *array, size_t buffer_len, size_t key_size,
+                         int (*cmp_fn)(void *left, void *right)) {
+    if (!pqueue || !array || !key_size || !cmp_fn) return false;
+
+    // keys first, then heap and pos aligned for uint32_t
+    size_t capacity = buffer_len / (key_size + 2 * sizeof(uint32_t));
+    size_t keys_len = (capacity * key_size + sizeof(uint32_t) - 1) / sizeof(uint32_t) * sizeof(uint32_t);
+    while (capacity && keys_len + 2 * capacity * sizeof(uint32_t) > buffer_len) {
+        capacity--;
+        keys_len = (capacity * key_size + sizeof(uint32_t) - 1) / sizeof(uint32_t) * sizeof(uint32_t);
+    }
+    if (!capacity || capacity > EMBLIB_IPQUEUE_NIL) return false;
+
+    *pqueue = (emblib_ipqueue_t) {
+            .keys     = array,
+            .heap     = (uint32_t *) ((char *) array + keys_len),
+            .pos      = (uint32_t *) ((char *) array + keys_len) + capacity,
+            .capacity = capacity,
+            .count    = 0,
+            .key_size = key_size,
+            .cmp_fn   = cmp_fn
+    };
+    memset(pqueue->pos, 0xFF, capacity * sizeof(uint32_t));
+    return true;
+}
+
+bool emblib_ipqueue_push(emblib_ipqueue_t *pqueue, uint32_t handle, void *key) {
+    if (!pqueue || !key || handle >= pqueue->capacity || pqueue->pos[handle] != EMBLIB_IPQUEUE_NIL) return false;
+
+    memcpy(ipqueue_key(pqueue, handle), key, pqueue->key_size);
+    ipqueue_set(pqueue, pqueue->count, handle);
+    pqueue->count++;
+    ipqueue_sift_up(pqueue, pqueue->count - 1);
+    return true;
+}
+
+bool emblib_ipqueue_pop(emblib_ipqueue_t *pqueue, uint32_t *handle, void *key) {
+    if (!emblib_ipqueue_peek(pqueue, handle, key)) return false;
+
+    ipqueue_delete_at(pqueue, 0);
+    return true;
+}
+
+bool emblib_ipqueue_peek(emblib_ipqueue_t *pqueue, uint32_t *handle, void *key) {
+    if (!pqueue || !pqueue->count) return false;
+
+    if (handle) *handle = pqueue->heap[0];
+    if (key) memcpy(key, ipqueue_key(pqueue, pqueue->heap[0]), pqueue->key_size);
+    return true;
+}
+
+bool emblib_ipqueue_change_key(emblib_ipqueue_t *pqueue, uint32_t handle, void *key) {
+    if (!key || !emblib_ipqueue_contains(pqueue, handle)) return false;
+
+    const bool raised = pqueue->cmp_fn(key, ipqueue_key(pqueue, handle)) > 0;
+    memcpy(ipqueue_key(pqueue, handle), key, pqueue->key_size);
+    if (raised) {
+        ipqueue_sift_up(pqueue, pqueue->pos[handle]);
+    } else {
+        ipqueue_sift_down(pqueue, pqueue->pos[handle]);
+    }
+    return true;
+}
+
+bool emblib_ipqueue_remove(emblib_ipqueue_t *pqueue, uint32_t handle) {
+    if (!emblib_ipqueue_contains(pqueue, handle)) return false;
+
+    ipqueue_delete_at(pqueue, pqueue->pos[handle]);
+    return true;
+}
+
+bool emblib_ipqueue_contains(emblib_ipqueue_t *pqueue, uint32_t handle) {
+    return pqueue && handle < pqueue->capacity && pqueue->pos[handle] != EMBLIB_IPQUEUE_NIL;
+}
+
+bool emblib_ipqueue_get_key(emblib_ipqueue_t *pqueue, uint32_t handle, void *key) {
+    if (!key || !emblib_ipqueue_contains(pqueue, handle)) return false;
+
+    memcpy(key, ipqueue_key(pqueue, handle), pqueue->key_size);
+    return true;
+}
+
+size_t emblib_ipqueue_size(emblib_ipqueue_t *pqueue) {
+    return pqueue ? pqueue->capacity : 0;
+}
+
+size_t emblib_ipqueue_count(emblib_ipqueue_t *pqueue) {
+    return pqueue ? pqueue->count : 0;
+}
+
+void emblib_ipqueue_flush(emblib_ipqueue_t *pqueue) {
+    if (pqueue) {
+        for (size_t i = 0; i < pqueue->count; i++) {
+            pqueue->pos[pqueue->heap[i]] = EMBLIB_IPQUEUE_NIL;
+        }
+        pqueue->count = 0;
+    }
+}
+
+bool emblib_ipqueue_is_empty(emblib_ipqueue_t *pqueue) {
+    return pqueue ? pqueue->count == 0 : false;
+}
@@ -0,0 +1,139 @@
+#ifndef __EMB_LIB_EMBLIB_IPQUEUE_H__
+#define __EMB_LIB_EMBLIB_IPQUEUE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+//! handle not in the queue
+#define EMBLIB_IPQUEUE_NIL UINT32_MAX
+
+/**
+ * @brief Indexed priority queue: binary heap of handles (0 .. capacity - 1, e.g. task ids) with
+ *        a key per handle and the heap position of every handle, so that the key of a queued
+ *        handle can be changed, or the handle removed, in O(log n) without searching.
+ *        The caller buffer holds the keys (indexed by handle), then the heap, then the positions.
+ */
+typedef struct _emblib_ipqueue_t {
+    void *keys;             //!< key of each handle
+    uint32_t *heap;         //!< handles in heap order
+    uint32_t *pos;          //!< heap position of each handle, EMBLIB_IPQUEUE_NIL when not queued
+    size_t capacity;        //!< number of handles
+    size_t count;           //!< number of queued handles
+    size_t key_size;        //!< size of a key
+    int (*cmp_fn)(void *left, void *right); //!< key compare function, > 0 when left has the higher priority
+} emblib_ipqueue_t;
+
+/**
+ * @brief Initializes an empty queue.
+ *
+ * @param[in,out] pqueue Pointer to the queue structure.
+ * @param[in] array Pointer to the memory of the queue, aligned for the keys and for uint32_t.
+ * @param[in] buffer_len Size in bytes of array: capacity * (key_size + 8) bytes at most.
+ * @param[in] key_size Size of a key in bytes.
+ * @param[in] cmp_fn Key compare function, > 0 when left has the higher priority.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_ipqueue_init(emblib_ipqueue_t *pqueue, void *array, size_t buffer_len, size_t key_size,
+                         int (*cmp_fn)(void *left, void *right));
+
+/**
+ * @brief Queues a handle with its key, O(log n).
+ *
+ * @param[in,out] pqueue Pointer to the queue structure.
+ * @param[in] handle Handle, lower than the capacity.
+ * @param[in] key Pointer to the key.
+ * @return true on success, false if the handle is out of range or already queued.
+ */
+bool emblib_ipqueue_push(emblib_ipqueue_t *pqueue, uint32_t handle, void *key);
+
+/**
+ * @brief Dequeues the handle with the highest priority, O(log n).
+ *
+ * @param[in,out] pqueue Pointer to the queue structure.
+ * @param[out] handle Pointer to the memory for the handle, may be NULL.
+ * @param[out] key Pointer to the memory for its key, may be NULL.
+ * @return true on success, false if the queue is empty.
+ */
+bool emblib_ipqueue_pop(emblib_ipqueue_t *pqueue, uint32_t *handle, void *key);
+
+/**
+ * @brief Peeks the handle with the highest priority, O(1).
+ *
+ * @param[in] pqueue Pointer to the queue structure.
+ * @param[out] handle Pointer to the memory for the handle, may be NULL.
+ * @param[out] key Pointer to the memory for its key, may be NULL.
+ * @return true on success, false if the queue is empty.
+ */
+bool emblib_ipqueue_peek(emblib_ipqueue_t *pqueue, uint32_t *handle, void *key);
+
+/**
+ * @brief Changes the key of a queued handle (raise or lower its priority), O(log n).
+ *
+ * @param[in,out] pqueue Pointer to the queue structure.
+ * @param[in] handle Queued handle.
+ * @param[in] key Pointer to the new key.
+ * @return true on success, false if the handle is not queued.
+ */
+bool emblib_ipqueue_change_key(emblib_ipqueue_t *pqueue, uint32_t handle, void *key);
+
+/**
+ * @brief Removes a queued handle, O(log n).
+ *
+ * @param[in,out] pqueue Pointer to the queue structure.
+ * @param[in] handle Queued handle.
+ * @return true on success, false if the handle is not queued.
+ */
+bool emblib_ipqueue_remove(emblib_ipqueue_t *pqueue, uint32_t handle);
+
+/**
+ * @brief Checks if a handle is queued, O(1).
+ *
+ * @param[in] pqueue Pointer to the queue structure.
+ * @param[in] handle Handle.
+ * @return true if the handle is queued, false otherwise.
+ */
+bool emblib_ipqueue_contains(emblib_ipqueue_t *pqueue, uint32_t handle);
+
+/**
+ * @brief Copies the key of a queued handle, O(1).
+ *
+ * @param[in] pqueue Pointer to the queue structure.
+ * @param[in] handle Queued handle.
+ * @param[out] key Pointer to the memory for the key.
+ * @return true on success, false if the handle is not queued.
+ */
+bool emblib_ipqueue_get_key(emblib_ipqueue_t *pqueue, uint32_t handle, void *key);
+
+/**
+ * @brief Returns the number of handles of the queue.
+ *
+ * @param[in] pqueue Pointer to the queue structure.
+ * @return number of handles.
+ */
+size_t emblib_ipqueue_size(emblib_ipqueue_t *pqueue);
+
+/**
+ * @brief Returns the number of queued handles.
+ *
+ * @param[in] pqueue Pointer to the queue structure.
+ * @return number of queued handles.
+ */
+size_t emblib_ipqueue_count(emblib_ipqueue_t *pqueue);
+
+/**
+ * @brief Dequeues every handle.
+ *
+ * @param[in,out] pqueue Pointer to the queue structure.
+ */
+void emblib_ipqueue_flush(emblib_ipqueue_t *pqueue);
+
+/**
+ * @brief Checks if no handle is queued.
+ *
+ * @param[in] pqueue Pointer to the queue structure.
+ * @return true if the queue is empty, false otherwise.
+ */
+bool emblib_ipqueue_is_empty(emblib_ipqueue_t *pqueue);
+
+#endif //__EMB_LIB_EMBLIB_IPQUEUE_H__
@@ -0,0 +1,76 @@
+#include "emblib_lf_stack.h"
+#include "emblib_thread_safety.h"
+
+static uint64_t lf_stack_pack(uint64_t old, uint32_t index) {
+    return ((old >> 32) + 1) << 32 | index;
+}
+
+bool emblib_lf_stack_init(emblib_lf_stack_t *stack, void *array, size_t buffer_len, size_t size_elem, bool full) {
+    if (!stack || !array || !size_elem) return false;
+
+    // nodes first, then the next indices, aligned for uint32_t
+    size_t capacity = buffer_len / (size_elem + sizeof(uint32_t));
+    while (capacity && (capacity * size_elem + sizeof(uint32_t) - 1) / sizeof(uint32_t) * sizeof(uint32_t) +
+                       capacity * sizeof(uint32_t) > buffer_len) {
+        capacity--;
+    }
+    if (!capacity || capacity >= EMBLIB_LF_STACK_NIL) return false;
+
+    const size_t next_offset = (capacity * size_elem + sizeof(uint32_t) - 1) / sizeof(uint32_t) * sizeof(uint32_t);
+    stack->array = array;
+    stack->next = (uint32_t *) ((char *) array + next_offset);
+    stack->capacity = capacity;
+    stack->elem_size = size_elem;
+
+    if (full) {
+        for (size_t i = 0; i < capacity; i++) {
+            stack->next[i] = i + 1 < capacity ? (uint32_t) (i + 1) : EMBLIB_LF_STACK_NIL;
+        }
+        stack->head = 0;
+    } else {
+        stack->head = EMBLIB_LF_STACK_NIL;
+    }
+    return true;
+}
+
+bool emblib_lf_stack_push(emblib_lf_stack_t *stack, void *node) {
+    if (!stack || !node) return false;
+
+    const size_t offset = (size_t) ((char *) node - (char *) stack->array);
+    if ((char *) node < (char *) stack->array || offset % stack->elem_size ||
+        offset / stack->elem_size >= stack->capacity) {
+        return false;
+    }
+    const uint32_t index = (uint32_t) (offset / stack->elem_size);
+
+    uint64_t old = EMBLIB_LF_LOAD(&stack->head, EMBLIB_LF_RELAXED);
+    do {
+        EMBLIB_LF_STORE(&stack->next[index], (uint32_t) old, EMBLIB_LF_RELAXED);
+        // release: the node contents and its next index are visible to the thread that pops it
+    } while (!EMBLIB_LF_CAS(&stack->head, &old, lf_stack_pack(old, index), EMBLIB_LF_RELEASE, EMBLIB_LF_RELAXED));
+    return true;
+}
+
+void *emblib_lf_stack_pop(emblib_lf_stack_t *stack) {
+    if (!stack) return NULL;
+
+    uint64_t old = EMBLIB_LF_LOAD(&stack->head, EMBLIB_LF_ACQUIRE);
+    for (;;) {
+        const uint32_t index = (uint32_t) old;
+        if (index == EMBLIB_LF_STACK_NIL) return NULL;
+
+        // may be stale if another thread popped the node meanwhile: the tag makes the CAS fail then
+        const uint32_t next = EMBLIB_LF_LOAD(&stack->next[index], EMBLIB_LF_RELAXED);
+        if (EMBLIB_LF_CAS(&stack->head, &old, lf_stack_pack(old, next), EMBLIB_LF_ACQUIRE, EMBLIB_LF_ACQUIRE)) {
+            return (char *) stack->array + (size_t) index * stack->elem_size;
+        }
+    }
+}
+
+size_t emblib_lf_stack_size(emblib_lf_stack_t *stack) {
+    return stack ? stack->capacity : 0;
+}
+
+bool emblib_lf_stack_is_empty(emblib_lf_stack_t *stack) {
+    return stack ? (uint32_t) EMBLIB_LF_LOAD(&stack->head, EMBLIB_LF_RELAXED) == EMBLIB_LF_STACK_NIL : false;
+}
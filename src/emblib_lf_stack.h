@@ -0,0 +1,74 @@
+#ifndef __EMB_LIB_EMBLIB_LF_STACK_H__
+#define __EMB_LIB_EMBLIB_LF_STACK_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+//! index of no node
+#define EMBLIB_LF_STACK_NIL UINT32_MAX
+
+/**
+ * @brief Lock-free LIFO stack (Treiber) of the nodes of a static pool, safe for any number of
+ *        pushing and popping threads. The head packs a 32-bit modification tag with the index of
+ *        the top node into one 64-bit word, so a single CAS both swaps the top and defeats ABA
+ *        (a node popped and pushed back between our load and our CAS changes the tag).
+ *        Typical use is a free list shared between threads: pop a free node, fill it, hand it
+ *        over, push it back once done.
+ *        The caller buffer holds the nodes followed by one next index per node. Targets without
+ *        a native 64-bit CAS go through libatomic.
+ */
+typedef struct _emblib_lf_stack_t {
+    uint64_t head;          //!< tag << 32 | index of the top node
+    void *array;            //!< nodes
+    uint32_t *next;         //!< index of the node below each node
+    size_t capacity;        //!< number of nodes
+    size_t elem_size;       //!< size of a node
+} emblib_lf_stack_t;
+
+/**
+ * @brief Initializes the stack. Not thread-safe.
+ *
+ * @param[in,out] stack Pointer to the stack structure.
+ * @param[in] array Pointer to the memory of the nodes, aligned for uint32_t.
+ * @param[in] buffer_len Size in bytes of array.
+ * @param[in] size_elem Size of a node in bytes.
+ * @param[in] full true to start with every node in the stack (a free list), false to start empty.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_lf_stack_init(emblib_lf_stack_t *stack, void *array, size_t buffer_len, size_t size_elem, bool full);
+
+/**
+ * @brief Pushes a node of the pool.
+ *
+ * @param[in,out] stack Pointer to the stack structure.
+ * @param[in] node Pointer to a node of the pool, not already in the stack.
+ * @return true if the push is successful, false if node is not a node of the pool.
+ */
+bool emblib_lf_stack_push(emblib_lf_stack_t *stack, void *node);
+
+/**
+ * @brief Pops the top node.
+ *
+ * @param[in,out] stack Pointer to the stack structure.
+ * @return pointer to the node, NULL if the stack is empty.
+ */
+void *emblib_lf_stack_pop(emblib_lf_stack_t *stack);
+
+/**
+ * @brief Returns the number of nodes of the pool.
+ *
+ * @param[in] stack Pointer to the stack structure.
+ * @return Number of nodes.
+ */
+size_t emblib_lf_stack_size(emblib_lf_stack_t *stack);
+
+/**
+ * @brief Checks if the stack is empty, only a snapshot while other threads run.
+ *
+ * @param[in] stack Pointer to the stack structure.
+ * @return true if the stack is empty, false otherwise.
+ */
+bool emblib_lf_stack_is_empty(emblib_lf_stack_t *stack);
+
+#endif //__EMB_LIB_EMBLIB_LF_STACK_H__
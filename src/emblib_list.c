@@ -1,4 +1,5 @@
 #include "emblib_list.h"
+#include "emblib_sort.h"
 #include <string.h>
 
 bool emblib_list_init(emblib_list_t *list, void *array, size_t buffer_len, size_t size_elem,
@@ -10,43 +11,98 @@ void emblib_list_flush(emblib_list_t *list) {
     emblib_circ_buffer_flush(list);
 }
 
+static char *list_slot(emblib_list_t *list, size_t index) {
+    return (char *) list->array + ((list->head + index) % emblib_list_size(list)) * list->elem_size;
+}
+
+/**
+ * @brief move count elements from the logical position src to the logical position dst,
+ *        splitting the copy where the source or the destination wraps around the array
+ */
+static void list_move(emblib_list_t *list, size_t dst, size_t src, size_t count) {
+    const size_t size = emblib_list_size(list);
+    const size_t elem_size = list->elem_size;
+    char *base = (char *) list->array;
+
+    if (dst > src) {
+        // shifting towards the tail: copy from the end so nothing is overwritten before being moved
+        while (count) {
+            const size_t src_last = (list->head + src + count - 1) % size;
+            const size_t dst_last = (list->head + dst + count - 1) % size;
+            size_t chunk = count;
+            if (chunk > src_last + 1) chunk = src_last + 1;
+            if (chunk > dst_last + 1) chunk = dst_last + 1;
+
+            memmove(base + (dst_last + 1 - chunk) * elem_size, base + (src_last + 1 - chunk) * elem_size,
+                    chunk * elem_size);
+            count -= chunk;
+        }
+    } else if (dst < src) {
+        size_t offset = 0;
+        while (count) {
+            const size_t src_pos = (list->head + src + offset) % size;
+            const size_t dst_pos = (list->head + dst + offset) % size;
+            size_t chunk = count;
+            if (chunk > size - src_pos) chunk = size - src_pos;
+            if (chunk > size - dst_pos) chunk = size - dst_pos;
+
+            memmove(base + dst_pos * elem_size, base + src_pos * elem_size, chunk * elem_size);
+            offset += chunk;
+            count -= chunk;
+        }
+    }
+}
+
 bool emblib_list_insert(emblib_list_t *list, size_t index, void *data) {
-    if (emblib_list_is_full(list) || index > list->count) return false;
+    return emblib_list_insert_range(list, index, data, 1);
+}
+
+bool emblib_list_remove(emblib_list_t *list, size_t index, void *data) {
+    return data ? emblib_list_remove_range(list, index, data, 1) : false;
+}
+
+bool emblib_list_insert_range(emblib_list_t *list, size_t index, void *data, size_t n) {
+    if (!list || !data || !n || index > list->count || emblib_circ_buffer_will_full(list, n)) return false;
 
     const size_t size = emblib_list_size(list);
-    const size_t insert_pos = (list->head + index) % size;
-    const size_t move_count = list->count - index;
-    void *src = (char *) list->array + insert_pos * list->elem_size;
-    void *dest = (char *) list->array + ((insert_pos + 1) % size) * list->elem_size;
 
-    if (move_count > 0) {
-        memmove(dest, src, move_count * list->elem_size);
+    list_move(list, index + n, index, list->count - index);
+
+    for (size_t i = 0; i < n; i++) {
+        list->copy_fn(list_slot(list, index + i), (char *) data + i * list->elem_size);
     }
 
-    list->copy_fn((char *) list->array + insert_pos * list->elem_size, data);
-    list->tail = (list->tail + 1) % size;
-    list->count++;
+    list->tail = (list->tail + n) % size;
+    list->count += n;
     return true;
 }
 
-bool emblib_list_remove(emblib_list_t *list, size_t index, void *data) {
-    if (emblib_list_is_empty(list) || index >= list->count) return false;
+bool emblib_list_remove_range(emblib_list_t *list, size_t index, void *data, size_t n) {
+    if (!list || !n || index >= list->count || n > list->count - index) return false;
 
     const size_t size = emblib_list_size(list);
 
-    const size_t remove_pos = (list->head + index) % size;
-    list->copy_fn(data, (char *) list->array + remove_pos * list->elem_size);
+    for (size_t i = 0; i < n; i++) {
+        if (data) {
+            list->copy_fn((char *) data + i * list->elem_size, list_slot(list, index + i));
+        } else if (list->free_fn) {
+            list->free_fn(list_slot(list, index + i));
+        }
+    }
 
-    size_t move_count = list->count - index - 1;
-    void *src = (char *) list->array + ((remove_pos + 1) % size) * list->elem_size;
-    void *dest = (char *) list->array + remove_pos * list->elem_size;
+    list_move(list, index, index + n, list->count - index - n);
 
-    if (move_count > 0) {
-        memmove(dest, src, move_count * list->elem_size);
-    }
+    list->tail = (list->tail + size - n) % size;
+    list->count -= n;
+    return true;
+}
+
+bool emblib_list_get_range(emblib_list_t *list, size_t index, void *data, size_t n) {
+    if (!list || !data || !n || index >= list->count || n > list->count - index) return false;
 
-    list->tail = (list->tail - 1 + size) % size;
-    list->count--;
+    for (size_t i = 0; i < n; i++) {
+        list->copy_fn((char *) data + i * list->elem_size, list_slot(list, index + i));
+    }
     return true;
 }
 
@@ -60,6 +116,95 @@ bool emblib_list_get(emblib_list_t *list, size_t index, void *data) {
     return true;
 }
 
+static void list_reverse(emblib_list_t *list, size_t first, size_t last) {
+    char tmp[list->elem_size];
+    char *base = (char *) list->array;
+
+    while (first + 1 < last) {
+        last--;
+        memcpy(tmp, base + first * list->elem_size, list->elem_size);
+        memcpy(base + first * list->elem_size, base + last * list->elem_size, list->elem_size);
+        memcpy(base + last * list->elem_size, tmp, list->elem_size);
+        first++;
+    }
+}
+
+void *emblib_list_linearize(emblib_list_t *list) {
+    if (!list) return NULL;
+
+    if (list->head) {
+        // rotate the whole array left by head with three reversals
+        const size_t size = emblib_list_size(list);
+        list_reverse(list, 0, list->head);
+        list_reverse(list, list->head, size);
+        list_reverse(list, 0, size);
+
+        list->head = 0;
+        list->tail = list->count % size;
+    }
+    return list->array;
+}
+
+void emblib_list_sort(emblib_list_t *list, int (*cmp_fn)(void *left, void *right)) {
+    if (!list || !cmp_fn || list->count < 2) return;
+
+    emblib_sort(emblib_list_linearize(list), list->count, list->elem_size, cmp_fn);
+}
+
+bool emblib_list_radix_sort(emblib_list_t *list, bool is_signed, void *scratch, size_t scratch_len) {
+    if (!list) return false;
+    if (list->count < 2) return true;
+
+    if (list->elem_size != 4 && list->elem_size != 8) return false;
+    if (!scratch || scratch_len < list->count * list->elem_size) return false;
+
+    return emblib_radix_sort(emblib_list_linearize(list), list->count, list->elem_size, is_signed, scratch,
+                             scratch_len);
+}
+
+/**
+ * @brief first index whose element is not before data (lower bound) or is after data (upper bound)
+ */
+static size_t list_bound(emblib_list_t *list, void *data, int (*cmp_fn)(void *left, void *right), bool upper) {
+    size_t first = 0;
+    size_t len = list->count;
+
+    while (len) {
+        const size_t half = len / 2;
+        const int cmp = cmp_fn(list_slot(list, first + half), data);
+        if (cmp < 0 || (upper && cmp == 0)) {
+            first += half + 1;
+            len -= half + 1;
+        } else {
+            len = half;
+        }
+    }
+    return first;
+}
+
+size_t emblib_list_lower_bound(emblib_list_t *list, void *data, int (*cmp_fn)(void *left, void *right)) {
+    if (!list || !data || !cmp_fn) return 0;
+
+    return list_bound(list, data, cmp_fn, false);
+}
+
+bool emblib_list_find_sorted(emblib_list_t *list, void *data, int (*cmp_fn)(void *left, void *right),
+                             size_t *index) {
+    if (!list || !data || !cmp_fn) return false;
+
+    const size_t pos = list_bound(list, data, cmp_fn, false);
+    if (pos == list->count || cmp_fn(list_slot(list, pos), data) != 0) return false;
+
+    if (index) *index = pos;
+    return true;
+}
+
+bool emblib_list_insert_sorted(emblib_list_t *list, void *data, int (*cmp_fn)(void *left, void *right)) {
+    if (!list || !data || !cmp_fn) return false;
+
+    return emblib_list_insert_range(list, list_bound(list, data, cmp_fn, true), data, 1);
+}
+
 bool emblib_list_is_empty(emblib_list_t *list) {
     return emblib_circ_buffer_is_empty(list);
 }
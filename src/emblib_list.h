@@ -59,6 +59,101 @@ bool emblib_list_remove(emblib_list_t *list, size_t index, void *data);
  */
 bool emblib_list_get(emblib_list_t *list, size_t index, void *data);
 
+/**
+ * @brief Inserts a block of contiguous elements starting at a specific index in the list.
+ *        The tail of the list is shifted only once, whatever the size of the block.
+ *
+ * @param[in,out] list Pointer to the list structure.
+ * @param[in] index Index at which to insert the first element.
+ * @param[in] data Pointer to the elements to be inserted.
+ * @param[in] n Number of elements to be inserted.
+ * @return true if the insert is successful, false otherwise (nothing is inserted).
+ */
+bool emblib_list_insert_range(emblib_list_t *list, size_t index, void *data, size_t n);
+
+/**
+ * @brief Removes a block of contiguous elements starting at a specific index in the list.
+ *        The tail of the list is shifted only once, whatever the size of the block.
+ *
+ * @param[in,out] list Pointer to the list structure.
+ * @param[in] index Index of the first element to be removed.
+ * @param[out] data Pointer to the memory where the removed elements will be stored. If NULL,
+ *                  the elements are discarded through free_fn.
+ * @param[in] n Number of elements to be removed.
+ * @return true if the remove is successful, false otherwise (nothing is removed).
+ */
+bool emblib_list_remove_range(emblib_list_t *list, size_t index, void *data, size_t n);
+
+/**
+ * @brief Gets a block of contiguous elements starting at a specific index without removing them.
+ *
+ * @param[in,out] list Pointer to the list structure.
+ * @param[in] index Index of the first element.
+ * @param[out] data Pointer to the memory where the elements will be stored.
+ * @param[in] n Number of elements to get.
+ * @return true if the get is successful, false otherwise.
+ */
+bool emblib_list_get_range(emblib_list_t *list, size_t index, void *data, size_t n);
+
+/**
+ * @brief Rotates the storage so the elements are contiguous from the beginning of the array.
+ *
+ * @param[in,out] list Pointer to the list structure.
+ * @return Pointer to the first element (the storage array).
+ */
+void *emblib_list_linearize(emblib_list_t *list);
+
+/**
+ * @brief Sorts the list in place (introsort), wherever the storage wraps. Not stable.
+ *
+ * @param[in,out] list Pointer to the list structure.
+ * @param[in] cmp_fn Comparator, returns < 0 when left goes before right, 0 when equal, > 0 otherwise.
+ */
+void emblib_list_sort(emblib_list_t *list, int (*cmp_fn)(void *left, void *right));
+
+/**
+ * @brief Sorts a list of integers (elem_size 4 or 8) in ascending order with a radix sort.
+ *
+ * @param[in,out] list Pointer to the list structure.
+ * @param[in] is_signed true for two's complement keys, false for unsigned keys.
+ * @param[in] scratch Pointer to a scratch area of at least count * elem_size bytes.
+ * @param[in] scratch_len Size in bytes of scratch.
+ * @return true on success, false on invalid parameters.
+ */
+bool emblib_list_radix_sort(emblib_list_t *list, bool is_signed, void *scratch, size_t scratch_len);
+
+/**
+ * @brief Binary search on a sorted list: index of the first element not ordered before data.
+ *
+ * @param[in,out] list Pointer to the list structure, sorted by cmp_fn.
+ * @param[in] data Pointer to the element to look for.
+ * @param[in] cmp_fn Comparator used to sort the list.
+ * @return Index of the first element >= data, emblib_list_count() if there is none.
+ */
+size_t emblib_list_lower_bound(emblib_list_t *list, void *data, int (*cmp_fn)(void *left, void *right));
+
+/**
+ * @brief Binary search on a sorted list.
+ *
+ * @param[in,out] list Pointer to the list structure, sorted by cmp_fn.
+ * @param[in] data Pointer to the element to look for.
+ * @param[in] cmp_fn Comparator used to sort the list.
+ * @param[out] index Index of the element found. May be NULL.
+ * @return true if an element equal to data exists, false otherwise.
+ */
+bool emblib_list_find_sorted(emblib_list_t *list, void *data, int (*cmp_fn)(void *left, void *right),
+                             size_t *index);
+
+/**
+ * @brief Inserts an element keeping the list sorted. Equal elements keep their insertion order.
+ *
+ * @param[in,out] list Pointer to the list structure, sorted by cmp_fn.
+ * @param[in] data Pointer to the element to be inserted.
+ * @param[in] cmp_fn Comparator used to sort the list.
+ * @return true if the insert is successful, false otherwise.
+ */
+bool emblib_list_insert_sorted(emblib_list_t *list, void *data, int (*cmp_fn)(void *left, void *right));
+
 /**
  * @brief Checks if the list is empty.
  *
@@ -0,0 +1,158 @@
+#include "emblib_map.h"
+#include "emblib_robin_hood.h"
+#include <string.h>
+
+#define MAP_MAX_ALIGN 8
+
+/**
+ * @brief alignment guessed from a size: its lowest power of two factor, at most MAP_MAX_ALIGN
+ */
+static size_t map_align(size_t size) {
+    const size_t align = size & (~size + 1);
+    return (align && align < MAP_MAX_ALIGN) ? align : MAP_MAX_ALIGN;
+}
+
+static size_t map_round_up(size_t value, size_t align) {
+    return (value + align - 1) / align * align;
+}
+
+static size_t map_value_offset(size_t key_size, size_t value_size) {
+    return map_round_up(key_size, map_align(value_size));
+}
+
+size_t emblib_map_slot_size(size_t key_size, size_t value_size) {
+    const size_t key_align = map_align(key_size);
+    const size_t value_align = map_align(value_size);
+    return map_round_up(map_value_offset(key_size, value_size) + value_size,
+                        key_align > value_align ? key_align : value_align);
+}
+
+static char *map_slot(emblib_map_t *map, size_t index) {
+    return (char *) map->array + index * map->slot_size;
+}
+
+static emblib_robin_hood_t map_table(emblib_map_t *map) {
+    return (emblib_robin_hood_t) {
+            .array     = (char *) map->array,
+            .dist      = map->dist,
+            .mask      = map->capacity - 1,
+            .slot_size = map->slot_size
+    };
+}
+
+static bool map_match(void *ctx, void *slot, void *key) {
+    return ((emblib_map_t *) ctx)->equals_fn(slot, key);
+}
+
+/**
+ * @brief look for key; on a miss, pos and dist receive the slot where the key belongs
+ */
+static bool map_find(emblib_map_t *map, void *key, size_t *pos, size_t *dist) {
+    const emblib_robin_hood_t table = map_table(map);
+    return emblib_robin_hood_find(&table, map->hash_fn(key), map_match, map, key, pos, dist);
+}
+
+bool emblib_map_init(emblib_map_t *map, void *array, size_t buffer_len, size_t key_size, size_t value_size,
+                     uint64_t (*hash_fn)(void *key), bool (*equals_fn)(void *left, void *right)) {
+    if (!map || !array || !key_size || !hash_fn || !equals_fn) return false;
+
+    const size_t slot_size = emblib_map_slot_size(key_size, value_size);
+    size_t capacity = 1;
+    while (capacity * 2 <= buffer_len / (slot_size + 1)) {
+        capacity *= 2;
+    }
+    if (capacity * (slot_size + 1) > buffer_len || capacity < 2) return false;
+
+    *map = (emblib_map_t) {
+            .array        = array,
+            .dist         = (uint8_t *) array + capacity * slot_size,
+            .capacity     = capacity,
+            .max_count    = capacity - (capacity >= 8 ? capacity / 8 : 1),
+            .count        = 0,
+            .key_size     = key_size,
+            .value_size   = value_size,
+            .value_offset = map_value_offset(key_size, value_size),
+            .slot_size    = slot_size,
+            .hash_fn      = hash_fn,
+            .equals_fn    = equals_fn
+    };
+    memset(map->dist, 0, capacity);
+    return true;
+}
+
+void *emblib_map_get(emblib_map_t *map, void *key) {
+    if (!map || !key || !map->count) return NULL;
+
+    size_t pos, dist;
+    return map_find(map, key, &pos, &dist) ? map_slot(map, pos) + map->value_offset : NULL;
+}
+
+void *emblib_map_get_or_insert(emblib_map_t *map, void *key, bool *inserted) {
+    if (inserted) *inserted = false;
+    if (!map || !key) return NULL;
+
+    size_t pos, dist;
+    if (map_find(map, key, &pos, &dist)) return map_slot(map, pos) + map->value_offset;
+    if (emblib_map_is_full(map) || dist > EMBLIB_ROBIN_HOOD_MAX_DIST) return NULL;
+
+    const emblib_robin_hood_t table = map_table(map);
+    if (!emblib_robin_hood_make_room(&table, pos)) return NULL;
+
+    char *slot = map_slot(map, pos);
+    memcpy(slot, key, map->key_size);
+    memset(slot + map->value_offset, 0, map->value_size);
+    map->dist[pos] = (uint8_t) dist;
+    map->count++;
+
+    if (inserted) *inserted = true;
+    return slot + map->value_offset;
+}
+
+bool emblib_map_put(emblib_map_t *map, void *key, void *value) {
+    if (!value) return false;
+
+    void *slot_value = emblib_map_get_or_insert(map, key, NULL);
+    if (!slot_value) return false;
+
+    memcpy(slot_value, value, map->value_size);
+    return true;
+}
+
+bool emblib_map_remove(emblib_map_t *map, void *key, void *value) {
+    if (!map || !key || !map->count) return false;
+
+    size_t pos, dist;
+    if (!map_find(map, key, &pos, &dist)) return false;
+
+    if (value) {
+        memcpy(value, map_slot(map, pos) + map->value_offset, map->value_size);
+    }
+
+    const emblib_robin_hood_t table = map_table(map);
+    emblib_robin_hood_erase(&table, pos);
+    map->count--;
+    return true;
+}
+
+size_t emblib_map_size(emblib_map_t *map) {
+    return map ? map->max_count : 0;
+}
+
+size_t emblib_map_count(emblib_map_t *map) {
+    return map ? map->count : 0;
+}
+
+void emblib_map_flush(emblib_map_t *map) {
+    if (map) {
+        memset(map->dist, 0, map->capacity);
+        map->count = 0;
+    }
+}
+
+bool emblib_map_is_full(emblib_map_t *map) {
+    return map ? map->count >= map->max_count : false;
+}
+
+bool emblib_map_is_empty(emblib_map_t *map) {
+    return map ? map->count == 0 : false;
+}
@@ -0,0 +1,123 @@
+#ifndef __EMB_LIB_EMBLIB_MAP_H__
+#define __EMB_LIB_EMBLIB_MAP_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Fixed-capacity key/value hash map over a caller buffer (Robin Hood linear probing,
+ *        backward-shift deletion, no tombstones). Keys and values are copied as plain bytes.
+ *        The buffer holds the slots (key, padding, value) followed by one probe-distance byte
+ *        per slot; the number of slots is the largest power of two that fits.
+ */
+typedef struct _emblib_map_t {
+    void *array;            //!< slots
+    uint8_t *dist;          //!< probe distance + 1 of each slot, 0 for an empty slot
+    size_t capacity;        //!< number of slots (power of two)
+    size_t max_count;       //!< maximum number of entries (7/8 of the slots)
+    size_t count;           //!< number of entries stored
+    size_t key_size;        //!< size of a key
+    size_t value_size;      //!< size of a value
+    size_t value_offset;    //!< offset of the value inside a slot
+    size_t slot_size;       //!< size of a slot
+    uint64_t (*hash_fn)(void *key);                 //! hash function
+    bool (*equals_fn)(void *left, void *right);     //! key equality function
+} emblib_map_t;
+
+/**
+ * @brief Size in bytes of a slot for key_size and value_size, to dimension the caller buffer:
+ *        slots * (emblib_map_slot_size(key_size, value_size) + 1).
+ *
+ * @param[in] key_size Size of a key in bytes.
+ * @param[in] value_size Size of a value in bytes.
+ * @return slot size in bytes.
+ */
+size_t emblib_map_slot_size(size_t key_size, size_t value_size);
+
+/**
+ * @brief Initializes the map.
+ *
+ * @param[in,out] map Pointer to the map structure.
+ * @param[in] array Pointer to the memory where entries will be stored (8-byte aligned).
+ * @param[in] buffer_len Size in bytes of array.
+ * @param[in] key_size Size of a key in bytes.
+ * @param[in] value_size Size of a value in bytes.
+ * @param[in] hash_fn Hash function of a key. Equal keys must have the same hash.
+ * @param[in] equals_fn Key equality function.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_map_init(emblib_map_t *map, void *array, size_t buffer_len, size_t key_size, size_t value_size,
+                     uint64_t (*hash_fn)(void *key), bool (*equals_fn)(void *left, void *right));
+
+/**
+ * @brief Looks a key up.
+ *
+ * @param[in] map Pointer to the map structure.
+ * @param[in] key Pointer to the key.
+ * @return pointer to the value stored in the map, NULL if the key is not in the map.
+ *         Valid until the next insert or remove.
+ */
+void *emblib_map_get(emblib_map_t *map, void *key);
+
+/**
+ * @brief Looks a key up and inserts it, with a zeroed value, if it is not in the map.
+ *
+ * @param[in,out] map Pointer to the map structure.
+ * @param[in] key Pointer to the key.
+ * @param[out] inserted Set to true when the key was inserted. May be NULL.
+ * @return pointer to the value stored in the map, NULL if the map is full or the key would land
+ *         more than 255 slots away from its home slot (possible before the map is full with a
+ *         poor hash_fn). Valid until the next insert or remove.
+ */
+void *emblib_map_get_or_insert(emblib_map_t *map, void *key, bool *inserted);
+
+/**
+ * @brief Inserts a key or overwrites its value.
+ *
+ * @param[in,out] map Pointer to the map structure.
+ * @param[in] key Pointer to the key.
+ * @param[in] value Pointer to the value.
+ * @return true on success, false if the map is full or the key hits the probe distance cap
+ *         (see emblib_map_get_or_insert).
+ */
+bool emblib_map_put(emblib_map_t *map, void *key, void *value);
+
+/**
+ * @brief Removes a key from the map.
+ *
+ * @param[in,out] map Pointer to the map structure.
+ * @param[in] key Pointer to the key.
+ * @param[out] value Pointer to the memory where the value will be stored. May be NULL.
+ * @return true if the remove is successful, false if the key is not in the map.
+ */
+bool emblib_map_remove(emblib_map_t *map, void *key, void *value);
+
+/**
+ * @brief Returns the maximum number of entries of the map.
+ *
+ * @param[in] map Pointer to the map structure.
+ * @return Maximum number of entries.
+ */
+size_t emblib_map_size(emblib_map_t *map);
+
+/**
+ * @brief Returns the number of entries currently stored in the map.
+ *
+ * @param[in] map Pointer to the map structure.
+ * @return Number of entries in the map.
+ */
+size_t emblib_map_count(emblib_map_t *map);
+
+/**
+ * @brief Clears all entries from the map.
+ *
+ * @param[in,out] map Pointer to the map structure.
+ */
+void emblib_map_flush(emblib_map_t *map);
+
+bool emblib_map_is_full(emblib_map_t *map);
+
+bool emblib_map_is_empty(emblib_map_t *map);
+
+#endif //__EMB_LIB_EMBLIB_MAP_H__
@@ -0,0 +1,83 @@
+#include "emblib_mlqueue.h"
+#include "emblib_util.h"
+
+/**
+ * @brief highest non-empty level, the ready bitmap must not be 0
+ */
+static size_t mlqueue_top(emblib_mlqueue_t *mlqueue) {
+    return 31 - emblib_clz32(mlqueue->ready);
+}
+
+bool emblib_mlqueue_init(emblib_mlqueue_t *mlqueue, void *array, size_t buffer_len, size_t levels,
+                         size_t size_elem, void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data)) {
+    if (!mlqueue || !array || !size_elem || !levels || levels > EMBLIB_MLQUEUE_MAX_LEVELS) return false;
+
+    const size_t ring_len = buffer_len / levels / size_elem * size_elem;
+    if (!ring_len) return false;
+
+    for (size_t l = 0; l < levels; l++) {
+        if (!emblib_circ_buffer_init(&mlqueue->rings[l], (char *) array + l * ring_len, ring_len, size_elem,
+                                     copy_fn, free_fn)) {
+            return false;
+        }
+    }
+    mlqueue->ready = 0;
+    mlqueue->levels = levels;
+    mlqueue->count = 0;
+    return true;
+}
+
+bool emblib_mlqueue_enqueue(emblib_mlqueue_t *mlqueue, size_t level, void *data) {
+    if (!mlqueue || level >= mlqueue->levels) return false;
+
+    if (!emblib_circ_buffer_insert(&mlqueue->rings[level], data)) return false;
+    mlqueue->ready |= (uint32_t) 1 << level;
+    mlqueue->count++;
+    return true;
+}
+
+bool emblib_mlqueue_dequeue(emblib_mlqueue_t *mlqueue, void *data, size_t *level) {
+    if (!mlqueue || !mlqueue->ready) return false;
+
+    const size_t top = mlqueue_top(mlqueue);
+    if (!emblib_circ_buffer_retrieve(&mlqueue->rings[top], data)) return false;
+    if (emblib_circ_buffer_is_empty(&mlqueue->rings[top])) mlqueue->ready &= ~((uint32_t) 1 << top);
+    mlqueue->count--;
+    if (level) *level = top;
+    return true;
+}
+
+bool emblib_mlqueue_peek(emblib_mlqueue_t *mlqueue, void *data, size_t *level) {
+    if (!mlqueue || !mlqueue->ready) return false;
+
+    const size_t top = mlqueue_top(mlqueue);
+    if (!emblib_circ_buffer_peek(&mlqueue->rings[top], data)) return false;
+    if (level) *level = top;
+    return true;
+}
+
+size_t emblib_mlqueue_count_level(emblib_mlqueue_t *mlqueue, size_t level) {
+    return (mlqueue && level < mlqueue->levels) ? emblib_circ_buffer_count(&mlqueue->rings[level]) : 0;
+}
+
+size_t emblib_mlqueue_size(emblib_mlqueue_t *mlqueue) {
+    return mlqueue ? emblib_circ_buffer_size(&mlqueue->rings[0]) : 0;
+}
+
+size_t emblib_mlqueue_count(emblib_mlqueue_t *mlqueue) {
+    return mlqueue ? mlqueue->count : 0;
+}
+
+void emblib_mlqueue_flush(emblib_mlqueue_t *mlqueue) {
+    if (mlqueue) {
+        for (size_t l = 0; l < mlqueue->levels; l++) {
+            emblib_circ_buffer_flush(&mlqueue->rings[l]);
+        }
+        mlqueue->ready = 0;
+        mlqueue->count = 0;
+    }
+}
+
+bool emblib_mlqueue_is_empty(emblib_mlqueue_t *mlqueue) {
+    return mlqueue ? mlqueue->count == 0 : false;
+}
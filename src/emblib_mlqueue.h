@@ -0,0 +1,108 @@
+#ifndef __EMB_LIB_EMBLIB_MLQUEUE_H__
+#define __EMB_LIB_EMBLIB_MLQUEUE_H__
+
+#include "emblib_circ_buffer.h"
+
+//! maximum number of priority levels (one bit of the ready bitmap each)
+#define EMBLIB_MLQUEUE_MAX_LEVELS 32
+
+/**
+ * @brief Multi-level priority queue (RTOS ready-queue style): one circ_buffer ring per priority
+ *        level and a bitmap of the non-empty levels. Dequeue takes the highest non-empty level
+ *        with one count-leading-zeros, O(1), and is FIFO within a level.
+ *        The caller buffer is split into equal rings, one per level; a higher level has a
+ *        higher priority.
+ */
+typedef struct _emblib_mlqueue_t {
+    emblib_circ_buffer_t rings[EMBLIB_MLQUEUE_MAX_LEVELS];  //!< ring of each level
+    uint32_t ready;         //!< bit l set when level l is not empty
+    size_t levels;          //!< number of levels
+    size_t count;           //!< number of elements of all the levels
+} emblib_mlqueue_t;
+
+/**
+ * @brief Initializes the queue.
+ *
+ * @param[in,out] mlqueue Pointer to the queue structure.
+ * @param[in] array Pointer to the memory where elements will be stored.
+ * @param[in] buffer_len Size in bytes of array, split equally between the levels.
+ * @param[in] levels Number of priority levels, 1 to EMBLIB_MLQUEUE_MAX_LEVELS.
+ * @param[in] size_elem Size of each element in bytes.
+ * @param[in] copy_fn Copy function of the elements, mandatory.
+ * @param[in] free_fn Free function of the elements, called by flush; may be NULL.
+ * @return true if initialization is successful, false otherwise (a level would have no room).
+ */
+bool emblib_mlqueue_init(emblib_mlqueue_t *mlqueue, void *array, size_t buffer_len, size_t levels,
+                         size_t size_elem, void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data));
+
+/**
+ * @brief Enqueues an element at the back of its level, O(1).
+ *
+ * @param[in,out] mlqueue Pointer to the queue structure.
+ * @param[in] level Priority level of the element.
+ * @param[in] data Pointer to the element.
+ * @return true on success, false if the level is invalid or full.
+ */
+bool emblib_mlqueue_enqueue(emblib_mlqueue_t *mlqueue, size_t level, void *data);
+
+/**
+ * @brief Dequeues the oldest element of the highest non-empty level, O(1).
+ *
+ * @param[in,out] mlqueue Pointer to the queue structure.
+ * @param[out] data Pointer to the memory for the element.
+ * @param[out] level Pointer to the memory for its level, may be NULL.
+ * @return true on success, false if the queue is empty.
+ */
+bool emblib_mlqueue_dequeue(emblib_mlqueue_t *mlqueue, void *data, size_t *level);
+
+/**
+ * @brief Reads the element that emblib_mlqueue_dequeue would return, without removing it.
+ *
+ * @param[in] mlqueue Pointer to the queue structure.
+ * @param[out] data Pointer to the memory for the element.
+ * @param[out] level Pointer to the memory for its level, may be NULL.
+ * @return true on success, false if the queue is empty.
+ */
+bool emblib_mlqueue_peek(emblib_mlqueue_t *mlqueue, void *data, size_t *level);
+
+/**
+ * @brief Returns the number of elements of one level.
+ *
+ * @param[in] mlqueue Pointer to the queue structure.
+ * @param[in] level Priority level.
+ * @return number of elements of the level, 0 for an invalid level.
+ */
+size_t emblib_mlqueue_count_level(emblib_mlqueue_t *mlqueue, size_t level);
+
+/**
+ * @brief Returns the number of elements that each level can store.
+ *
+ * @param[in] mlqueue Pointer to the queue structure.
+ * @return capacity of a level in elements.
+ */
+size_t emblib_mlqueue_size(emblib_mlqueue_t *mlqueue);
+
+/**
+ * @brief Returns the number of elements of all the levels.
+ *
+ * @param[in] mlqueue Pointer to the queue structure.
+ * @return number of elements.
+ */
+size_t emblib_mlqueue_count(emblib_mlqueue_t *mlqueue);
+
+/**
+ * @brief Clears every level.
+ *
+ * @param[in,out] mlqueue Pointer to the queue structure.
+ */
+void emblib_mlqueue_flush(emblib_mlqueue_t *mlqueue);
+
+/**
+ * @brief Checks if every level is empty.
+ *
+ * @param[in] mlqueue Pointer to the queue structure.
+ * @return true if the queue holds no element, false otherwise.
+ */
+bool emblib_mlqueue_is_empty(emblib_mlqueue_t *mlqueue);
+
+#endif //__EMB_LIB_EMBLIB_MLQUEUE_H__
@@ -0,0 +1,145 @@
+#include "emblib_pqueue.h"
+#include <string.h>
+
+static char *pqueue_slot(emblib_pqueue_t *pqueue, size_t index) {
+    return (char *) pqueue->array + index * pqueue->elem_size;
+}
+
+/**
+ * @brief move the hole at index up until elem fits, parents move down into it
+ */
+static size_t pqueue_sift_up(emblib_pqueue_t *pqueue, size_t index, void *elem) {
+    while (index > 0) {
+        const size_t parent = (index - 1) / 2;
+        if (pqueue->cmp_fn(elem, pqueue_slot(pqueue, parent)) <= 0) break;
+        memcpy(pqueue_slot(pqueue, index), pqueue_slot(pqueue, parent), pqueue->elem_size);
+        index = parent;
+    }
+    return index;
+}
+
+/**
+ * @brief move the hole at index down until elem fits, the larger child moves up into it
+ */
+static size_t pqueue_sift_down(emblib_pqueue_t *pqueue, size_t index, void *elem) {
+    for (;;) {
+        size_t child = 2 * index + 1;
+        if (child >= pqueue->count) break;
+        if (child + 1 < pqueue->count &&
+            pqueue->cmp_fn(pqueue_slot(pqueue, child + 1), pqueue_slot(pqueue, child)) > 0) {
+            child++;
+        }
+        if (pqueue->cmp_fn(pqueue_slot(pqueue, child), elem) <= 0) break;
+        memcpy(pqueue_slot(pqueue, index), pqueue_slot(pqueue, child), pqueue->elem_size);
+        index = child;
+    }
+    return index;
+}
+
+static void pqueue_build(emblib_pqueue_t *pqueue) {
+    char tmp[pqueue->elem_size];
+
+    // Floyd: sift down every parent, last one first
+    for (size_t i = pqueue->count / 2; i-- > 0;) {
+        memcpy(tmp, pqueue_slot(pqueue, i), pqueue->elem_size);
+        memcpy(pqueue_slot(pqueue, pqueue_sift_down(pqueue, i, tmp)), tmp, pqueue->elem_size);
+    }
+}
+
+bool emblib_pqueue_init(emblib_pqueue_t *pqueue, void *array, size_t buffer_len, size_t size_elem,
+                        void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
+                        int (*cmp_fn)(void *left, void *right)) {
+    if (!pqueue || !array || !buffer_len || !size_elem || buffer_len % size_elem || !copy_fn || !cmp_fn) {
+        return false;
+    }
+
+    *pqueue = (emblib_pqueue_t) {
+            .array     = array,
+            .capacity  = buffer_len / size_elem,
+            .count     = 0,
+            .elem_size = size_elem,
+            .copy_fn   = copy_fn,
+            .free_fn   = free_fn,
+            .cmp_fn    = cmp_fn
+    };
+    return true;
+}
+
+bool emblib_pqueue_heapify(emblib_pqueue_t *pqueue, size_t count) {
+    if (!pqueue || count > pqueue->capacity) return false;
+
+    pqueue->count = count;
+    pqueue_build(pqueue);
+    return true;
+}
+
+bool emblib_pqueue_push(emblib_pqueue_t *pqueue, void *data) {
+    if (!pqueue || !data || emblib_pqueue_is_full(pqueue)) return false;
+
+    pqueue->copy_fn(pqueue_slot(pqueue, pqueue_sift_up(pqueue, pqueue->count, data)), data);
+    pqueue->count++;
+    return true;
+}
+
+bool emblib_pqueue_push_n(emblib_pqueue_t *pqueue, void *data, size_t n) {
+    if (!pqueue || !data || n > pqueue->capacity - pqueue->count) return false;
+
+    if (n >= pqueue->count) {
+        for (size_t i = 0; i < n; i++) {
+            pqueue->copy_fn(pqueue_slot(pqueue, pqueue->count + i), (char *) data + i * pqueue->elem_size);
+        }
+        pqueue->count += n;
+        pqueue_build(pqueue);
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            emblib_pqueue_push(pqueue, (char *) data + i * pqueue->elem_size);
+        }
+    }
+    return true;
+}
+
+bool emblib_pqueue_pop(emblib_pqueue_t *pqueue, void *data) {
+    if (!pqueue || !data || emblib_pqueue_is_empty(pqueue)) return false;
+
+    char last[pqueue->elem_size];
+
+    pqueue->copy_fn(data, pqueue_slot(pqueue, 0));
+    pqueue->count--;
+    if (pqueue->count) {
+        memcpy(last, pqueue_slot(pqueue, pqueue->count), pqueue->elem_size);
+        memcpy(pqueue_slot(pqueue, pqueue_sift_down(pqueue, 0, last)), last, pqueue->elem_size);
+    }
+    return true;
+}
+
+bool emblib_pqueue_peek(emblib_pqueue_t *pqueue, void *data) {
+    if (!pqueue || !data || emblib_pqueue_is_empty(pqueue)) return false;
+
+    pqueue->copy_fn(data, pqueue_slot(pqueue, 0));
+    return true;
+}
+
+size_t emblib_pqueue_size(emblib_pqueue_t *pqueue) {
+    return pqueue ? pqueue->capacity : 0;
+}
+
+size_t emblib_pqueue_count(emblib_pqueue_t *pqueue) {
+    return pqueue ? pqueue->count : 0;
+}
+
+void emblib_pqueue_flush(emblib_pqueue_t *pqueue) {
+    if (pqueue) {
+        for (size_t i = 0; i < pqueue->count && pqueue->free_fn; i++) {
+            pqueue->free_fn(pqueue_slot(pqueue, i));
+        }
+        pqueue->count = 0;
+    }
+}
+
+bool emblib_pqueue_is_full(emblib_pqueue_t *pqueue) {
+    return pqueue ? pqueue->count >= pqueue->capacity : false;
+}
+
+bool emblib_pqueue_is_empty(emblib_pqueue_t *pqueue) {
+    return pqueue ? pqueue->count == 0 : false;
+}
@@ -0,0 +1,124 @@
+#ifndef __EMB_LIB_EMBLIB_PQUEUE_H__
+#define __EMB_LIB_EMBLIB_PQUEUE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Priority queue: binary max-heap in a caller array. The element with the highest
+ *        priority for cmp_fn is at index 0; the children of element i are 2i + 1 and 2i + 2.
+ */
+typedef struct _emblib_pqueue_t {
+    void *array;            //!< heap
+    size_t capacity;        //!< maximum number of elements
+    size_t count;           //!< number of elements stored
+    size_t elem_size;       //!< size of each element
+    void (*copy_fn)(void *dest, void *src);     //! copy function
+    void (*free_fn)(void *data);                //! free function
+    int (*cmp_fn)(void *left, void *right);     //! compare function, > 0 when left has the higher priority
+} emblib_pqueue_t;
+
+/**
+ * @brief Initializes an empty priority queue.
+ *
+ * @param[in,out] pqueue Pointer to the priority queue structure.
+ * @param[in] array Pointer to the memory where elements will be stored.
+ * @param[in] buffer_len Size in bytes of array, a multiple of size_elem.
+ * @param[in] size_elem Size of each element in bytes.
+ * @param[in] cmp_fn Compare function, > 0 when left has the higher priority. Pass a reversed
+ *                   comparator for a min-queue.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_pqueue_init(emblib_pqueue_t *pqueue, void *array, size_t buffer_len, size_t size_elem,
+                        void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
+                        int (*cmp_fn)(void *left, void *right));
+
+/**
+ * @brief Takes the first count elements already in the array as the contents of the queue and
+ *        orders them into a heap, O(count).
+ *
+ * @param[in,out] pqueue Pointer to the priority queue structure.
+ * @param[in] count Number of elements in the array.
+ * @return true on success, false if count exceeds the capacity.
+ */
+bool emblib_pqueue_heapify(emblib_pqueue_t *pqueue, size_t count);
+
+/**
+ * @brief Pushes an element, O(log n).
+ *
+ * @param[in,out] pqueue Pointer to the priority queue structure.
+ * @param[in] data Pointer to the element to be pushed.
+ * @return true if the push is successful, false if the queue is full.
+ */
+bool emblib_pqueue_push(emblib_pqueue_t *pqueue, void *data);
+
+/**
+ * @brief Pushes n elements. A batch at least as large as the queue is appended and the whole
+ *        heap rebuilt in O(count + n), otherwise the elements are pushed one by one.
+ *
+ * @param[in,out] pqueue Pointer to the priority queue structure.
+ * @param[in] data Pointer to the elements to be pushed.
+ * @param[in] n Number of elements.
+ * @return true if the push is successful, false if the queue has no room for n elements (nothing is pushed).
+ */
+bool emblib_pqueue_push_n(emblib_pqueue_t *pqueue, void *data, size_t n);
+
+/**
+ * @brief Pops the element with the highest priority, O(log n).
+ *
+ * @param[in,out] pqueue Pointer to the priority queue structure.
+ * @param[out] data Pointer to the memory where the popped element will be stored.
+ * @return true if the pop is successful, false if the queue is empty.
+ */
+bool emblib_pqueue_pop(emblib_pqueue_t *pqueue, void *data);
+
+/**
+ * @brief Peeks the element with the highest priority, O(1).
+ *
+ * @param[in] pqueue Pointer to the priority queue structure.
+ * @param[out] data Pointer to the memory where the peeked element will be stored.
+ * @return true if the peek is successful, false if the queue is empty.
+ */
+bool emblib_pqueue_peek(emblib_pqueue_t *pqueue, void *data);
+
+/**
+ * @brief Returns the maximum number of elements of the queue.
+ *
+ * @param[in] pqueue Pointer to the priority queue structure.
+ * @return Maximum number of elements.
+ */
+size_t emblib_pqueue_size(emblib_pqueue_t *pqueue);
+
+/**
+ * @brief Returns the number of elements currently stored in the queue.
+ *
+ * @param[in] pqueue Pointer to the priority queue structure.
+ * @return Number of elements in the queue.
+ */
+size_t emblib_pqueue_count(emblib_pqueue_t *pqueue);
+
+/**
+ * @brief Clears all elements from the queue.
+ *
+ * @param[in,out] pqueue Pointer to the priority queue structure.
+ */
+void emblib_pqueue_flush(emblib_pqueue_t *pqueue);
+
+/**
+ * @brief Checks if the queue is full.
+ *
+ * @param[in] pqueue Pointer to the priority queue structure.
+ * @return true if no more element can be pushed, false otherwise.
+ */
+bool emblib_pqueue_is_full(emblib_pqueue_t *pqueue);
+
+/**
+ * @brief Checks if the queue is empty.
+ *
+ * @param[in] pqueue Pointer to the priority queue structure.
+ * @return true if the queue holds no element, false otherwise.
+ */
+bool emblib_pqueue_is_empty(emblib_pqueue_t *pqueue);
+
+#endif //__EMB_LIB_EMBLIB_PQUEUE_H__
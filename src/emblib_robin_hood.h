@@ -0,0 +1,107 @@
+#ifndef __EMB_LIB_EMBLIB_ROBIN_HOOD_H__
+#define __EMB_LIB_EMBLIB_ROBIN_HOOD_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * Robin Hood linear probing core shared by emblib_hash_set and emblib_map: the probe, the
+ * shift that makes room for an insert and the backward-shift delete. The tables keep one
+ * probe-distance byte per slot (distance + 1, 0 for an empty slot), which caps the distance.
+ */
+
+//! largest probe distance + 1 a slot can record
+#define EMBLIB_ROBIN_HOOD_MAX_DIST UINT8_MAX
+
+/**
+ * @brief View of a table: slots of slot_size bytes and their distance bytes.
+ */
+typedef struct _emblib_robin_hood_t {
+    char *array;            //!< slots
+    uint8_t *dist;          //!< probe distance + 1 of each slot, 0 for an empty slot
+    size_t mask;            //!< number of slots (power of two) - 1
+    size_t slot_size;       //!< size of a slot
+} emblib_robin_hood_t;
+
+static inline char *emblib_robin_hood_slot(const emblib_robin_hood_t *table, size_t index) {
+    return table->array + index * table->slot_size;
+}
+
+/**
+ * @brief Looks for data from its home slot. On a miss, pos and dist receive the slot where data
+ *        belongs and its distance + 1 (may exceed EMBLIB_ROBIN_HOOD_MAX_DIST).
+ *
+ * @param[in] table Table view.
+ * @param[in] hash Hash of data.
+ * @param[in] match Returns true when the slot holds data.
+ * @param[in] ctx Passed to match.
+ * @param[in] data Element or key looked for.
+ * @param[out] pos Slot of data, or where it belongs.
+ * @param[out] dist Distance + 1 of the slot where data belongs, only set on a miss.
+ * @return true if data is in the table.
+ */
+static inline bool emblib_robin_hood_find(const emblib_robin_hood_t *table, uint64_t hash,
+                                          bool (*match)(void *ctx, void *slot, void *data), void *ctx,
+                                          void *data, size_t *pos, size_t *dist) {
+    size_t index = (size_t) hash & table->mask;
+    size_t d = 1;
+
+    // the elements of a cluster are ordered by distance: stop when ours would have been placed
+    while (table->dist[index] >= d) {
+        if (table->dist[index] == d && match(ctx, emblib_robin_hood_slot(table, index), data)) {
+            *pos = index;
+            return true;
+        }
+        index = (index + 1) & table->mask;
+        d++;
+    }
+
+    *pos = index;
+    *dist = d;
+    return false;
+}
+
+/**
+ * @brief Frees slot pos by moving every slot from pos to the end of its cluster one slot further.
+ *
+ * @param[in] table Table view, with at least one empty slot.
+ * @param[in] pos Slot returned by a missed emblib_robin_hood_find.
+ * @return true on success, false (nothing moved) if a moved slot would pass the distance cap.
+ */
+static inline bool emblib_robin_hood_make_room(const emblib_robin_hood_t *table, size_t pos) {
+    size_t end = pos;
+    while (table->dist[end]) {
+        if (table->dist[end] == EMBLIB_ROBIN_HOOD_MAX_DIST) return false;
+        end = (end + 1) & table->mask;
+    }
+
+    while (end != pos) {
+        const size_t prev = (end - 1) & table->mask;
+        memcpy(emblib_robin_hood_slot(table, end), emblib_robin_hood_slot(table, prev), table->slot_size);
+        table->dist[end] = table->dist[prev] + 1;
+        end = prev;
+    }
+    return true;
+}
+
+/**
+ * @brief Empties slot pos with a backward shift: the rest of the cluster moves one slot closer
+ *        to home, no tombstones.
+ *
+ * @param[in] table Table view.
+ * @param[in] pos Occupied slot.
+ */
+static inline void emblib_robin_hood_erase(const emblib_robin_hood_t *table, size_t pos) {
+    size_t next = (pos + 1) & table->mask;
+    while (table->dist[next] > 1) {
+        memcpy(emblib_robin_hood_slot(table, pos), emblib_robin_hood_slot(table, next), table->slot_size);
+        table->dist[pos] = table->dist[next] - 1;
+        pos = next;
+        next = (next + 1) & table->mask;
+    }
+    table->dist[pos] = 0;
+}
+
+#endif //__EMB_LIB_EMBLIB_ROBIN_HOOD_H__
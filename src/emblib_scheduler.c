@@ -0,0 +1,245 @@
+#ifndef _GNU_SOURCE
+// syscall() is not declared under a strict -std=c17
+#define _GNU_SOURCE
+#endif
+
+#include "emblib_scheduler.h"
+#include "emblib_thread_safety.h"
+#include <sched.h>
+#include <string.h>
+
+#if defined(__linux__) && !defined(EMBLIB_SCHEDULER_NO_FUTEX)
+#define SCHEDULER_FUTEX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+//! worker running in the current thread, NULL outside of the workers
+static _Thread_local emblib_worker_t *scheduler_self = NULL;
+
+static void task_copy(void *dest, void *src) {
+    memcpy(dest, src, sizeof(emblib_task_t));
+}
+
+static uint32_t scheduler_random(emblib_worker_t *worker) {
+    // xorshift32
+    uint32_t x = worker->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return worker->rng = x;
+}
+
+// =============================================================================
+// PARKING
+// =============================================================================
+
+static void scheduler_park_wait(emblib_scheduler_t *scheduler, uint32_t epoch) {
+#ifdef SCHEDULER_FUTEX
+    // returns at once if epoch already moved on
+    syscall(SYS_futex, &scheduler->epoch, FUTEX_WAIT_PRIVATE, epoch, NULL, NULL, 0);
+#else
+    pthread_mutex_lock(&scheduler->park_lock);
+    while (EMBLIB_LF_LOAD(&scheduler->epoch, EMBLIB_LF_ACQUIRE) == epoch &&
+           !EMBLIB_LF_LOAD(&scheduler->stop, EMBLIB_LF_ACQUIRE)) {
+        pthread_cond_wait(&scheduler->park_cond, &scheduler->park_lock);
+    }
+    pthread_mutex_unlock(&scheduler->park_lock);
+#endif
+}
+
+static void scheduler_wake(emblib_scheduler_t *scheduler, int count) {
+#ifdef SCHEDULER_FUTEX
+    EMBLIB_LF_FETCH_ADD(&scheduler->epoch, 1, EMBLIB_LF_RELEASE);
+    syscall(SYS_futex, &scheduler->epoch, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+#else
+    pthread_mutex_lock(&scheduler->park_lock);
+    EMBLIB_LF_FETCH_ADD(&scheduler->epoch, 1, EMBLIB_LF_RELEASE);
+    if (count == 1) {
+        pthread_cond_signal(&scheduler->park_cond);
+    } else {
+        pthread_cond_broadcast(&scheduler->park_cond);
+    }
+    pthread_mutex_unlock(&scheduler->park_lock);
+#endif
+}
+
+/**
+ * @brief wake a parked worker, if any, after publishing a task
+ */
+static void scheduler_notify(emblib_scheduler_t *scheduler) {
+    // pairs with the increment of sleepers in scheduler_park: either the sleeper sees the task or we see it
+    EMBLIB_LF_FENCE(EMBLIB_LF_SEQ_CST);
+    if (EMBLIB_LF_LOAD(&scheduler->sleepers, EMBLIB_LF_RELAXED)) {
+        scheduler_wake(scheduler, 1);
+    }
+}
+
+// =============================================================================
+// TASKS
+// =============================================================================
+
+static bool scheduler_has_work(emblib_scheduler_t *scheduler) {
+    if (EMBLIB_LF_LOAD(&scheduler->inject_count, EMBLIB_LF_RELAXED)) return true;
+    for (size_t i = 0; i < scheduler->num_workers; i++) {
+        if (!emblib_ws_deque_is_empty(&scheduler->workers[i].deque)) return true;
+    }
+    return false;
+}
+
+static bool scheduler_take_injected(emblib_scheduler_t *scheduler, emblib_task_t *task) {
+    if (!EMBLIB_LF_LOAD(&scheduler->inject_count, EMBLIB_LF_RELAXED)) return false;
+
+    pthread_mutex_lock(&scheduler->inject_lock);
+    const bool taken = emblib_queue_dequeue(&scheduler->inject, task);
+    if (taken) EMBLIB_LF_STORE(&scheduler->inject_count, scheduler->inject_count - 1, EMBLIB_LF_RELAXED);
+    pthread_mutex_unlock(&scheduler->inject_lock);
+    return taken;
+}
+
+/**
+ * @brief next task for self (NULL for a thread outside of the workers)
+ */
+static bool scheduler_find_task(emblib_scheduler_t *scheduler, emblib_worker_t *self, emblib_task_t *task) {
+    if (self && emblib_ws_deque_pop(&self->deque, task)) return true;
+    if (scheduler_take_injected(scheduler, task)) return true;
+
+    // one round of victims from a random start
+    const size_t n = scheduler->num_workers;
+    const size_t start = self ? scheduler_random(self) % n : 0;
+    for (size_t i = 0; i < n; i++) {
+        emblib_worker_t *victim = &scheduler->workers[(start + i) % n];
+        if (victim != self && emblib_ws_deque_steal(&victim->deque, task)) return true;
+    }
+    return false;
+}
+
+static void scheduler_run(emblib_task_t *task) {
+    task->fn(task->arg);
+    if (task->group) EMBLIB_LF_FETCH_ADD(&task->group->pending, -1, EMBLIB_LF_RELEASE);
+}
+
+static void scheduler_park(emblib_scheduler_t *scheduler) {
+    const uint32_t epoch = EMBLIB_LF_LOAD(&scheduler->epoch, EMBLIB_LF_ACQUIRE);
+    EMBLIB_LF_FETCH_ADD(&scheduler->sleepers, 1, EMBLIB_LF_SEQ_CST);
+    if (!EMBLIB_LF_LOAD(&scheduler->stop, EMBLIB_LF_ACQUIRE) && !scheduler_has_work(scheduler)) {
+        scheduler_park_wait(scheduler, epoch);
+    }
+    EMBLIB_LF_FETCH_ADD(&scheduler->sleepers, -1, EMBLIB_LF_RELAXED);
+}
+
+static void *scheduler_worker_main(void *arg) {
+    emblib_worker_t *self = (emblib_worker_t *) arg;
+    emblib_scheduler_t *scheduler = self->scheduler;
+    emblib_task_t task;
+
+    scheduler_self = self;
+    while (!EMBLIB_LF_LOAD(&scheduler->stop, EMBLIB_LF_ACQUIRE)) {
+        if (scheduler_find_task(scheduler, self, &task)) {
+            scheduler_run(&task);
+        } else {
+            scheduler_park(scheduler);
+        }
+    }
+    scheduler_self = NULL;
+    return NULL;
+}
+
+// =============================================================================
+// API
+// =============================================================================
+
+bool emblib_scheduler_init(emblib_scheduler_t *scheduler, emblib_worker_t *workers, size_t num_workers,
+                           void *array, size_t buffer_len) {
+    if (!scheduler || !workers || !num_workers || !array) return false;
+
+    // the injection queue and every deque get the same share, a whole number of tasks
+    const size_t share = buffer_len / (num_workers + 1) / sizeof(emblib_task_t) * sizeof(emblib_task_t);
+    if (!share) return false;
+
+    memset(scheduler, 0, sizeof(*scheduler));
+    scheduler->workers = workers;
+    scheduler->num_workers = num_workers;
+    if (!emblib_queue_init(&scheduler->inject, array, share, sizeof(emblib_task_t), task_copy, NULL)) return false;
+
+    for (size_t i = 0; i < num_workers; i++) {
+        if (!emblib_ws_deque_init(&workers[i].deque, (char *) array + (i + 1) * share, share,
+                                  sizeof(emblib_task_t))) {
+            return false;
+        }
+        workers[i].scheduler = scheduler;
+        workers[i].rng = 2654435761u * (uint32_t) (i + 1);
+    }
+
+    pthread_mutex_init(&scheduler->inject_lock, NULL);
+    pthread_mutex_init(&scheduler->park_lock, NULL);
+    pthread_cond_init(&scheduler->park_cond, NULL);
+
+    for (size_t i = 0; i < num_workers; i++) {
+        if (pthread_create(&workers[i].thread, NULL, scheduler_worker_main, &workers[i]) != 0) {
+            scheduler->num_workers = i;
+            emblib_scheduler_destroy(scheduler);
+            return false;
+        }
+    }
+    return true;
+}
+
+void emblib_scheduler_destroy(emblib_scheduler_t *scheduler) {
+    if (!scheduler) return;
+
+    EMBLIB_LF_STORE(&scheduler->stop, true, EMBLIB_LF_SEQ_CST);
+    scheduler_wake(scheduler, (int) scheduler->num_workers);
+    for (size_t i = 0; i < scheduler->num_workers; i++) {
+        pthread_join(scheduler->workers[i].thread, NULL);
+    }
+
+    pthread_cond_destroy(&scheduler->park_cond);
+    pthread_mutex_destroy(&scheduler->park_lock);
+    pthread_mutex_destroy(&scheduler->inject_lock);
+}
+
+void emblib_task_group_init(emblib_task_group_t *group) {
+    if (group) group->pending = 0;
+}
+
+bool emblib_scheduler_spawn(emblib_scheduler_t *scheduler, emblib_task_group_t *group, void (*fn)(void *arg),
+                            void *arg) {
+    if (!scheduler || !fn) return false;
+
+    emblib_task_t task = {.fn = fn, .arg = arg, .group = group};
+    if (group) EMBLIB_LF_FETCH_ADD(&group->pending, 1, EMBLIB_LF_RELAXED);
+
+    emblib_worker_t *self = scheduler_self;
+    bool queued;
+    if (self && self->scheduler == scheduler) {
+        queued = emblib_ws_deque_push(&self->deque, &task);
+    } else {
+        pthread_mutex_lock(&scheduler->inject_lock);
+        queued = emblib_queue_enqueue(&scheduler->inject, &task);
+        if (queued) EMBLIB_LF_STORE(&scheduler->inject_count, scheduler->inject_count + 1, EMBLIB_LF_RELAXED);
+        pthread_mutex_unlock(&scheduler->inject_lock);
+    }
+
+    if (queued) {
+        scheduler_notify(scheduler);
+    } else {
+        scheduler_run(&task);
+    }
+    return true;
+}
+
+void emblib_scheduler_wait(emblib_scheduler_t *scheduler, emblib_task_group_t *group) {
+    if (!scheduler || !group) return;
+
+    emblib_worker_t *self = scheduler_self && scheduler_self->scheduler == scheduler ? scheduler_self : NULL;
+    emblib_task_t task;
+    while (EMBLIB_LF_LOAD(&group->pending, EMBLIB_LF_ACQUIRE) > 0) {
+        if (scheduler_find_task(scheduler, self, &task)) {
+            scheduler_run(&task);
+        } else {
+            sched_yield();
+        }
+    }
+}
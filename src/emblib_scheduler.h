@@ -0,0 +1,107 @@
+#ifndef __EMB_LIB_EMBLIB_SCHEDULER_H__
+#define __EMB_LIB_EMBLIB_SCHEDULER_H__
+
+#include "emblib_queue.h"
+#include "emblib_ws_deque.h"
+#include <pthread.h>
+
+/**
+ * @brief Counter of the unfinished tasks spawned in it, for fork-join.
+ */
+typedef struct _emblib_task_group_t {
+    int64_t pending;        //!< spawned tasks not finished yet
+} emblib_task_group_t;
+
+/**
+ * @brief Task stored by value in the queues: no allocation per task.
+ */
+typedef struct _emblib_task_t {
+    void (*fn)(void *arg);          //!< function to run
+    void *arg;                      //!< its argument
+    emblib_task_group_t *group;     //!< group notified when fn returns, may be NULL
+} emblib_task_t;
+
+struct _emblib_scheduler_t;
+
+/**
+ * @brief Worker thread with its own work-stealing deque of tasks.
+ */
+typedef struct _emblib_worker_t {
+    emblib_ws_deque_t deque;                //!< tasks spawned by this worker
+    struct _emblib_scheduler_t *scheduler;  //!< owner scheduler
+    pthread_t thread;                       //!< worker thread
+    uint32_t rng;                           //!< state for picking a victim
+} emblib_worker_t;
+
+/**
+ * @brief Work-stealing task scheduler. Each worker runs the tasks of its own deque (newest first),
+ *        then the tasks submitted from outside through the injection queue, then steals the
+ *        oldest task of a random other worker. Idle workers park on a futex (Linux) or on a
+ *        condition variable (define EMBLIB_SCHEDULER_NO_FUTEX or other systems).
+ *        Workers and task storage are provided by the caller.
+ */
+typedef struct _emblib_scheduler_t {
+    emblib_worker_t *workers;       //!< worker array
+    size_t num_workers;             //!< number of workers
+    emblib_queue_t inject;          //!< tasks submitted from non-worker threads
+    pthread_mutex_t inject_lock;    //!< guards inject
+    size_t inject_count;            //!< number of tasks in inject, read without the lock
+    uint32_t epoch;                 //!< incremented to wake parked workers
+    uint32_t sleepers;              //!< number of workers parked or about to park
+    bool stop;                      //!< workers exit when set
+    pthread_mutex_t park_lock;      //!< condition variable fallback of the futex
+    pthread_cond_t park_cond;       //!< condition variable fallback of the futex
+} emblib_scheduler_t;
+
+/**
+ * @brief Initializes the scheduler and starts its workers.
+ *
+ * @param[in,out] scheduler Pointer to the scheduler structure.
+ * @param[in] workers Array of num_workers workers.
+ * @param[in] num_workers Number of worker threads to start.
+ * @param[in] array Pointer to the memory where tasks will be queued, split equally between the
+ *                  injection queue and the worker deques.
+ * @param[in] buffer_len Size in bytes of array.
+ * @return true if initialization is successful, false otherwise (no worker left running).
+ */
+bool emblib_scheduler_init(emblib_scheduler_t *scheduler, emblib_worker_t *workers, size_t num_workers,
+                           void *array, size_t buffer_len);
+
+/**
+ * @brief Stops and joins the workers. Tasks still queued are dropped: wait for their groups first.
+ *
+ * @param[in,out] scheduler Pointer to the scheduler structure.
+ */
+void emblib_scheduler_destroy(emblib_scheduler_t *scheduler);
+
+/**
+ * @brief Initializes an empty task group.
+ *
+ * @param[out] group Pointer to the group.
+ */
+void emblib_task_group_init(emblib_task_group_t *group);
+
+/**
+ * @brief Spawns a task. From a worker of the scheduler the task goes to the worker's own deque,
+ *        from any other thread to the injection queue. When that queue is full, the task runs
+ *        right away in the calling thread.
+ *
+ * @param[in,out] scheduler Pointer to the scheduler structure.
+ * @param[in,out] group Group to account the task in, may be NULL.
+ * @param[in] fn Function to run.
+ * @param[in] arg Its argument.
+ * @return true on success, false on invalid arguments.
+ */
+bool emblib_scheduler_spawn(emblib_scheduler_t *scheduler, emblib_task_group_t *group, void (*fn)(void *arg),
+                            void *arg);
+
+/**
+ * @brief Waits until every task of group has finished, running queued tasks meanwhile.
+ *        Can be called from a task (nested fork-join) or from any other thread.
+ *
+ * @param[in,out] scheduler Pointer to the scheduler structure.
+ * @param[in,out] group Group to wait for.
+ */
+void emblib_scheduler_wait(emblib_scheduler_t *scheduler, emblib_task_group_t *group);
+
+#endif //__EMB_LIB_EMBLIB_SCHEDULER_H__
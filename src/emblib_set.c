@@ -1,4 +1,5 @@
 #include "emblib_set.h"
+#include "emblib_sort.h"
 #include <string.h>
 
 bool emblib_set_init(emblib_set_t *set, void *array, size_t buffer_len, size_t size_elem,
@@ -6,18 +7,144 @@ bool emblib_set_init(emblib_set_t *set, void *array, size_t buffer_len, size_t s
                      int (*cmp_fn)(void *right, void *left)) {
     if (!cmp_fn) return false;
     set->cmp_fn = cmp_fn;
+    set->sorted = false;
+    set->bloom = NULL;
 
     return emblib_list_init(&set->list, array, buffer_len, size_elem, copy_fn, free_fn);
 }
 
+bool emblib_set_init_sorted(emblib_set_t *set, void *array, size_t buffer_len, size_t size_elem,
+                            void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
+                            int (*cmp_fn)(void *right, void *left)) {
+    if (!emblib_set_init(set, array, buffer_len, size_elem, copy_fn, free_fn, cmp_fn)) return false;
+
+    set->sorted = true;
+    return true;
+}
+
+bool emblib_set_attach_bloom(emblib_set_t *set, emblib_bloom_t *bloom) {
+    if (!set) return false;
+
+    set->bloom = bloom;
+    if (bloom) {
+        emblib_bloom_flush(bloom);
+        char *base = (char *) emblib_list_linearize(&set->list);
+        for (size_t i = 0; i < emblib_set_count(set); i++) {
+            emblib_bloom_add(bloom, base + i * set->list.elem_size);
+        }
+    }
+    return true;
+}
+
+static bool set_insert(emblib_set_t *set, size_t index, void *data) {
+    const bool bRet = emblib_list_insert(&set->list, index, data);
+    if (bRet && set->bloom) {
+        emblib_bloom_add(set->bloom, data);
+    }
+    return bRet;
+}
+
 bool emblib_set_add(emblib_set_t *set, void *data) {
-    if (emblib_set_contains(set, data) || emblib_set_is_full(set)) {
+    if (emblib_set_is_full(set)) {
         return false;
     }
-    return emblib_list_insert(&set->list, emblib_set_count(set), data);
+
+    if (set->sorted) {
+        // one binary search gives both the duplicate check and the insert position
+        const size_t pos = emblib_list_lower_bound(&set->list, data, set->cmp_fn);
+        char temp[set->list.elem_size];
+        if (emblib_list_get(&set->list, pos, temp) && set->cmp_fn(temp, data) == 0) {
+            return false;
+        }
+        return set_insert(set, pos, data);
+    }
+
+    if (emblib_set_contains(set, data)) {
+        return false;
+    }
+    return set_insert(set, emblib_set_count(set), data);
+}
+
+/**
+ * @brief number of elements of the sorted batch that are neither repeated in the batch nor in the set
+ */
+static size_t set_count_new(emblib_set_t *set, char *base, char *data, size_t n) {
+    const size_t elem_size = set->list.elem_size;
+    const size_t count = emblib_set_count(set);
+    size_t i = 0;
+    size_t added = 0;
+
+    for (size_t j = 0; j < n; j++) {
+        char *elem = data + j * elem_size;
+        if (j > 0 && set->cmp_fn(data + (j - 1) * elem_size, elem) == 0) continue;
+
+        while (i < count && set->cmp_fn(base + i * elem_size, elem) < 0) {
+            i++;
+        }
+        if (i == count || set->cmp_fn(base + i * elem_size, elem) != 0) added++;
+    }
+    return added;
+}
+
+bool emblib_set_add_many(emblib_set_t *set, void *data, size_t n) {
+    if (!set || !data) return false;
+
+    if (!set->sorted) {
+        for (size_t j = 0; j < n; j++) {
+            void *elem = (char *) data + j * set->list.elem_size;
+            if (!emblib_set_add(set, elem) && !emblib_set_contains(set, elem)) return false;
+        }
+        return true;
+    }
+
+    if (!n) return true;
+
+    const size_t elem_size = set->list.elem_size;
+    char *batch = (char *) data;
+    emblib_sort(batch, n, elem_size, set->cmp_fn);
+
+    char *base = (char *) emblib_list_linearize(&set->list);
+    const size_t count = emblib_set_count(set);
+    const size_t total = count + set_count_new(set, base, batch, n);
+    if (total > emblib_set_size(set)) return false;
+
+    // merge from the back: the write position never overtakes the unread elements of the set
+    size_t i = count;
+    size_t j = n;
+    size_t w = total;
+    while (j > 0) {
+        char *elem = batch + (j - 1) * elem_size;
+        if (j > 1 && set->cmp_fn(batch + (j - 2) * elem_size, elem) == 0) {
+            j--;
+            continue;
+        }
+
+        const int cmp = (i > 0) ? set->cmp_fn(base + (i - 1) * elem_size, elem) : -1;
+        if (cmp > 0) {
+            memmove(base + (w - 1) * elem_size, base + (i - 1) * elem_size, elem_size);
+            i--;
+        } else {
+            j--;
+            if (cmp == 0) continue;
+            set->list.copy_fn(base + (w - 1) * elem_size, elem);
+            if (set->bloom) emblib_bloom_add(set->bloom, elem);
+        }
+        w--;
+    }
+
+    set->list.count = total;
+    set->list.tail = total % emblib_set_size(set);
+    return true;
 }
 
 bool emblib_set_remove(emblib_set_t *set, void *data) {
+    if (set->sorted) {
+        size_t pos;
+        char temp[set->list.elem_size];
+        return emblib_list_find_sorted(&set->list, data, set->cmp_fn, &pos) &&
+               emblib_list_remove(&set->list, pos, temp);
+    }
+
     for (size_t i = 0; i < emblib_set_count(set); ++i) {
         char temp[set->list.elem_size];
         emblib_list_get(&set->list, i, temp);
@@ -29,6 +156,14 @@ bool emblib_set_remove(emblib_set_t *set, void *data) {
 }
 
 bool emblib_set_contains(emblib_set_t *set, void *data) {
+    if (set->bloom && !emblib_bloom_maybe_contains(set->bloom, data)) {
+        return false;
+    }
+
+    if (set->sorted) {
+        return emblib_list_find_sorted(&set->list, data, set->cmp_fn, NULL);
+    }
+
     for (size_t i = 0; i < emblib_set_count(set); i++) {
         char temp[set->list.elem_size];
         emblib_list_get(&set->list, i, temp);
@@ -39,12 +174,137 @@ bool emblib_set_contains(emblib_set_t *set, void *data) {
     return false;
 }
 
+/**
+ * @brief contiguous sorted view of the set: its own storage when the set is kept sorted, otherwise
+ *        a sorted byte copy taken from the scratch area (the set itself is left untouched)
+ */
+static char *set_sorted_view(emblib_set_t *set, char **scratch, size_t *scratch_len) {
+    if (set->sorted) {
+        return (char *) emblib_list_linearize(&set->list);
+    }
+
+    const size_t elem_size = set->list.elem_size;
+    const size_t count = emblib_set_count(set);
+    const size_t len = count * elem_size;
+    if (len > *scratch_len || (len && !*scratch)) return NULL;
+
+    // copy the ring in up to two segments
+    char *view = *scratch;
+    const size_t size = emblib_set_size(set);
+    const size_t first = (set->list.head + count <= size) ? count : size - set->list.head;
+    if (len) {
+        memcpy(view, (char *) set->list.array + set->list.head * elem_size, first * elem_size);
+        memcpy(view + first * elem_size, set->list.array, (count - first) * elem_size);
+        emblib_sort(view, count, elem_size, set->cmp_fn);
+    }
+
+    *scratch += len;
+    *scratch_len -= len;
+    return view;
+}
+
+typedef enum {
+    SET_UNION,
+    SET_INTERSECTION,
+    SET_DIFFERENCE
+} set_operation_t;
+
+static bool set_merge(emblib_set_t *a, emblib_set_t *b, emblib_set_t *out, set_operation_t op,
+                      void *scratch, size_t scratch_len) {
+    if (!a || !b || !out || out == a || out == b) return false;
+
+    const size_t elem_size = a->list.elem_size;
+    if (b->list.elem_size != elem_size || out->list.elem_size != elem_size) return false;
+
+    char *area = (char *) scratch;
+    char *base_a = set_sorted_view(a, &area, &scratch_len);
+    char *base_b = set_sorted_view(b, &area, &scratch_len);
+    if (!base_a || !base_b) return false;
+    const size_t count_a = emblib_set_count(a);
+    const size_t count_b = emblib_set_count(b);
+
+    emblib_set_flush(out);
+
+    size_t i = 0;
+    size_t j = 0;
+    bool bRet = true;
+    while (bRet && (i < count_a || j < count_b)) {
+        char *elem;
+        int cmp;
+        if (i == count_a) cmp = 1;
+        else if (j == count_b) cmp = -1;
+        else cmp = a->cmp_fn(base_a + i * elem_size, base_b + j * elem_size);
+
+        if (cmp < 0) {
+            elem = (op != SET_INTERSECTION) ? base_a + i * elem_size : NULL;
+            i++;
+        } else if (cmp > 0) {
+            elem = (op == SET_UNION) ? base_b + j * elem_size : NULL;
+            j++;
+        } else {
+            elem = (op != SET_DIFFERENCE) ? base_a + i * elem_size : NULL;
+            i++;
+            j++;
+        }
+
+        if (elem) {
+            bRet = set_insert(out, emblib_set_count(out), elem);
+        }
+
+        // nothing else can be produced once a is exhausted
+        if (op != SET_UNION && i == count_a) break;
+    }
+
+    if (!bRet) emblib_set_flush(out);
+    return bRet;
+}
+
+bool emblib_set_union(emblib_set_t *a, emblib_set_t *b, emblib_set_t *out, void *scratch, size_t scratch_len) {
+    return set_merge(a, b, out, SET_UNION, scratch, scratch_len);
+}
+
+bool emblib_set_intersection(emblib_set_t *a, emblib_set_t *b, emblib_set_t *out, void *scratch, size_t scratch_len) {
+    return set_merge(a, b, out, SET_INTERSECTION, scratch, scratch_len);
+}
+
+bool emblib_set_difference(emblib_set_t *a, emblib_set_t *b, emblib_set_t *out, void *scratch, size_t scratch_len) {
+    return set_merge(a, b, out, SET_DIFFERENCE, scratch, scratch_len);
+}
+
+bool emblib_set_is_subset(emblib_set_t *a, emblib_set_t *b, void *scratch, size_t scratch_len) {
+    if (!a || !b || a->list.elem_size != b->list.elem_size) return false;
+
+    const size_t count_a = emblib_set_count(a);
+    const size_t count_b = emblib_set_count(b);
+    if (count_a > count_b) return false;
+
+    const size_t elem_size = a->list.elem_size;
+    char *area = (char *) scratch;
+    char *base_a = set_sorted_view(a, &area, &scratch_len);
+    char *base_b = set_sorted_view(b, &area, &scratch_len);
+    if (!base_a || !base_b) return false;
+
+    size_t j = 0;
+    for (size_t i = 0; i < count_a; i++) {
+        int cmp = 1;
+        while (j < count_b && (cmp = a->cmp_fn(base_b + j * elem_size, base_a + i * elem_size)) < 0) {
+            j++;
+        }
+        if (j == count_b || cmp != 0) return false;
+        j++;
+    }
+    return true;
+}
+
 size_t emblib_set_size(emblib_set_t *set) {
     return emblib_list_size(&set->list);
 }
 
 void emblib_set_flush(emblib_set_t *set) {
     emblib_list_flush(&set->list);
+    if (set->bloom) {
+        emblib_bloom_flush(set->bloom);
+    }
 }
 
 size_t emblib_set_count(emblib_set_t *set) {
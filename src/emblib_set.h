@@ -2,6 +2,7 @@
 #define __EMB_LIB_EMBLIB_SET_H__
 
 #include "emblib_list.h"
+#include "emblib_bloom.h"
 
 /**
  * @brief Alias for list structure to represent a set.
@@ -11,6 +12,8 @@ typedef struct _emblib_set_t {
     emblib_list_t list;
 
     int (*cmp_fn)(void *right, void *left);
+    bool sorted;    //!< elements kept ordered by cmp_fn (see emblib_set_init_sorted)
+    emblib_bloom_t *bloom;  //!< optional filter of the elements (see emblib_set_attach_bloom)
 } emblib_set_t;
 
 /**
@@ -26,6 +29,31 @@ bool emblib_set_init(emblib_set_t *set, void *array, size_t buffer_len, size_t s
                      void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
                      int (*cmp_fn)(void *right, void *left));
 
+/**
+ * @brief Initializes a set that keeps its elements sorted in the buffer. contains and remove
+ *        use a binary search (O(log n)); cmp_fn must be a total order (< 0, 0, > 0).
+ *
+ * @param set Pointer to the set structure.
+ * @param array Pointer to the memory where elements will be stored.
+ * @param buffer_len Total number of elements that the set can store.
+ * @param size_elem Size of each element in bytes.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_set_init_sorted(emblib_set_t *set, void *array, size_t buffer_len, size_t size_elem,
+                            void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
+                            int (*cmp_fn)(void *right, void *left));
+
+/**
+ * @brief Attaches a bloom filter to the set: emblib_set_contains returns false without scanning
+ *        the set when the filter rules the element out. The filter is rebuilt from the current
+ *        elements. Removed elements stay in the filter until the set is flushed.
+ *
+ * @param set Pointer to the set structure.
+ * @param bloom Pointer to an initialized bloom filter, NULL to detach the current one.
+ * @return true on success, false otherwise.
+ */
+bool emblib_set_attach_bloom(emblib_set_t *set, emblib_bloom_t *bloom);
+
 /**
  * @brief Adds an element to the set.
  *
@@ -36,6 +64,18 @@ bool emblib_set_init(emblib_set_t *set, void *array, size_t buffer_len, size_t s
 bool emblib_set_add(emblib_set_t *set, void *data);
 
 
+/**
+ * @brief Adds a batch of elements to the set. On a sorted set the batch is sorted in place and
+ *        merged with the set in one linear pass; the operation is all or nothing. On an
+ *        unsorted set the elements are added one by one.
+ *
+ * @param set Pointer to the set structure.
+ * @param data Pointer to the elements to be added (reordered on a sorted set).
+ * @param n Number of elements.
+ * @return true if every element is in the set afterwards, false if the set has no room for them.
+ */
+bool emblib_set_add_many(emblib_set_t *set, void *data, size_t n);
+
 /**
  * @brief Removes an element from the set.
  *
@@ -77,6 +117,63 @@ size_t emblib_set_count(emblib_set_t *set);
  */
 void emblib_set_flush(emblib_set_t *set);
 
+/**
+ * @brief out = a | b, merged in one linear pass over both sets in sorted order, so cmp_fn must be
+ *        a total order (< 0, 0, > 0). A set kept sorted (emblib_set_init_sorted) is read in
+ *        place; an insertion-ordered set is copied and sorted into scratch and keeps its order.
+ *        out must be another set with the same element size; it is flushed first.
+ *
+ * @param a Pointer to the first set.
+ * @param b Pointer to the second set.
+ * @param out Pointer to the set receiving the result.
+ * @param scratch Scratch area of count * size_elem bytes for each insertion-ordered operand,
+ *        may be NULL when both operands are sorted sets.
+ * @param scratch_len Size in bytes of scratch.
+ * @return true on success, false on invalid sets, a too small scratch area or if out has no
+ *         room for the result (out is left empty).
+ */
+bool emblib_set_union(emblib_set_t *a, emblib_set_t *b, emblib_set_t *out, void *scratch, size_t scratch_len);
+
+/**
+ * @brief out = a & b. Same requirements as emblib_set_union.
+ *
+ * @param a Pointer to the first set.
+ * @param b Pointer to the second set.
+ * @param out Pointer to the set receiving the result.
+ * @param scratch Scratch area, see emblib_set_union.
+ * @param scratch_len Size in bytes of scratch.
+ * @return true on success, false on invalid sets, a too small scratch area or if out has no
+ *         room for the result (out is left empty).
+ */
+bool emblib_set_intersection(emblib_set_t *a, emblib_set_t *b, emblib_set_t *out, void *scratch,
+                             size_t scratch_len);
+
+/**
+ * @brief out = a - b. Same requirements as emblib_set_union.
+ *
+ * @param a Pointer to the first set.
+ * @param b Pointer to the second set.
+ * @param out Pointer to the set receiving the result.
+ * @param scratch Scratch area, see emblib_set_union.
+ * @param scratch_len Size in bytes of scratch.
+ * @return true on success, false on invalid sets, a too small scratch area or if out has no
+ *         room for the result (out is left empty).
+ */
+bool emblib_set_difference(emblib_set_t *a, emblib_set_t *b, emblib_set_t *out, void *scratch,
+                           size_t scratch_len);
+
+/**
+ * @brief Checks if every element of a is in b, with one linear pass over both sets in sorted
+ *        order. Neither set is modified.
+ *
+ * @param a Pointer to the candidate subset.
+ * @param b Pointer to the other set.
+ * @param scratch Scratch area, see emblib_set_union.
+ * @param scratch_len Size in bytes of scratch.
+ * @return true if a is a subset of b, false otherwise or if scratch is too small.
+ */
+bool emblib_set_is_subset(emblib_set_t *a, emblib_set_t *b, void *scratch, size_t scratch_len);
+
 bool emblib_set_is_full(emblib_set_t *set);
 
 bool emblib_set_is_empty(emblib_set_t *set);
@@ -0,0 +1,170 @@
+#include "emblib_sort.h"
+#include <stdint.h>
+#include <string.h>
+
+#define SORT_INSERTION_THRESHOLD 16
+
+static void sort_swap(char *a, char *b, size_t elem_size) {
+    char tmp[elem_size];
+    memcpy(tmp, a, elem_size);
+    memcpy(a, b, elem_size);
+    memcpy(b, tmp, elem_size);
+}
+
+static void insertion_sort(char *base, size_t count, size_t elem_size, int (*cmp_fn)(void *left, void *right)) {
+    char tmp[elem_size];
+    for (size_t i = 1; i < count; i++) {
+        if (cmp_fn(base + i * elem_size, base + (i - 1) * elem_size) >= 0) continue;
+
+        memcpy(tmp, base + i * elem_size, elem_size);
+        size_t j = i;
+        while (j > 0 && cmp_fn(tmp, base + (j - 1) * elem_size) < 0) {
+            j--;
+        }
+        memmove(base + (j + 1) * elem_size, base + j * elem_size, (i - j) * elem_size);
+        memcpy(base + j * elem_size, tmp, elem_size);
+    }
+}
+
+static void sift_down(char *base, size_t root, size_t count, size_t elem_size,
+                      int (*cmp_fn)(void *left, void *right)) {
+    for (;;) {
+        size_t child = 2 * root + 1;
+        if (child >= count) break;
+        if (child + 1 < count && cmp_fn(base + child * elem_size, base + (child + 1) * elem_size) < 0) {
+            child++;
+        }
+        if (cmp_fn(base + root * elem_size, base + child * elem_size) >= 0) break;
+
+        sort_swap(base + root * elem_size, base + child * elem_size, elem_size);
+        root = child;
+    }
+}
+
+static void heap_sort(char *base, size_t count, size_t elem_size, int (*cmp_fn)(void *left, void *right)) {
+    for (size_t i = count / 2; i-- > 0;) {
+        sift_down(base, i, count, elem_size, cmp_fn);
+    }
+    for (size_t end = count - 1; end > 0; end--) {
+        sort_swap(base, base + end * elem_size, elem_size);
+        sift_down(base, 0, end, elem_size, cmp_fn);
+    }
+}
+
+/**
+ * @brief sort a, b and c and move the median to the first position, where it is used as pivot
+ */
+static void median_of_three(char *base, size_t count, size_t elem_size, int (*cmp_fn)(void *left, void *right)) {
+    char *a = base;
+    char *b = base + (count / 2) * elem_size;
+    char *c = base + (count - 1) * elem_size;
+
+    if (cmp_fn(b, a) < 0) sort_swap(a, b, elem_size);
+    if (cmp_fn(c, b) < 0) {
+        sort_swap(b, c, elem_size);
+        if (cmp_fn(b, a) < 0) sort_swap(a, b, elem_size);
+    }
+    sort_swap(a, b, elem_size);
+}
+
+static void introsort(char *base, size_t count, size_t elem_size, int (*cmp_fn)(void *left, void *right),
+                      size_t depth) {
+    while (count > SORT_INSERTION_THRESHOLD) {
+        if (depth == 0) {
+            heap_sort(base, count, elem_size, cmp_fn);
+            return;
+        }
+        depth--;
+
+        median_of_three(base, count, elem_size, cmp_fn);
+
+        // Hoare partition around base[0]; scans stop on equal keys to keep duplicates balanced
+        size_t i = 0;
+        size_t j = count;
+        for (;;) {
+            do i++; while (i < count && cmp_fn(base + i * elem_size, base) < 0);
+            do j--; while (cmp_fn(base, base + j * elem_size) < 0);
+            if (i >= j) break;
+            sort_swap(base + i * elem_size, base + j * elem_size, elem_size);
+        }
+        sort_swap(base, base + j * elem_size, elem_size);
+
+        // recurse on the smaller side, iterate on the larger one
+        const size_t left = j;
+        const size_t right = count - j - 1;
+        if (left < right) {
+            introsort(base, left, elem_size, cmp_fn, depth);
+            base += (j + 1) * elem_size;
+            count = right;
+        } else {
+            introsort(base + (j + 1) * elem_size, right, elem_size, cmp_fn, depth);
+            count = left;
+        }
+    }
+    insertion_sort(base, count, elem_size, cmp_fn);
+}
+
+void emblib_sort(void *base, size_t count, size_t elem_size, int (*cmp_fn)(void *left, void *right)) {
+    if (!base || !elem_size || !cmp_fn || count < 2) return;
+
+    size_t depth = 0;
+    for (size_t n = count; n > 1; n >>= 1) {
+        depth += 2;
+    }
+    introsort((char *) base, count, elem_size, cmp_fn, depth);
+}
+
+static uint64_t radix_key(const char *elem, size_t elem_size, bool is_signed) {
+    if (elem_size == sizeof(uint32_t)) {
+        uint32_t v;
+        memcpy(&v, elem, sizeof(v));
+        return is_signed ? (v ^ 0x80000000u) : v;
+    }
+
+    uint64_t v;
+    memcpy(&v, elem, sizeof(v));
+    return is_signed ? (v ^ 0x8000000000000000ull) : v;
+}
+
+bool emblib_radix_sort(void *base, size_t count, size_t elem_size, bool is_signed, void *scratch,
+                       size_t scratch_len) {
+    if (!base || (elem_size != sizeof(uint32_t) && elem_size != sizeof(uint64_t))) return false;
+    if (count < 2) return true;
+    if (!scratch || scratch_len < count * elem_size) return false;
+
+    char *src = (char *) base;
+    char *dst = (char *) scratch;
+    size_t histogram[256];
+
+    for (size_t shift = 0; shift < elem_size * 8; shift += 8) {
+        memset(histogram, 0, sizeof(histogram));
+        for (size_t i = 0; i < count; i++) {
+            histogram[(radix_key(src + i * elem_size, elem_size, is_signed) >> shift) & 0xFF]++;
+        }
+
+        // every key has the same byte here: the pass would not change the order
+        if (histogram[(radix_key(src, elem_size, is_signed) >> shift) & 0xFF] == count) continue;
+
+        size_t offset = 0;
+        for (size_t b = 0; b < 256; b++) {
+            const size_t n = histogram[b];
+            histogram[b] = offset;
+            offset += n;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            const char *elem = src + i * elem_size;
+            const size_t b = (radix_key(elem, elem_size, is_signed) >> shift) & 0xFF;
+            memcpy(dst + histogram[b]++ * elem_size, elem, elem_size);
+        }
+
+        char *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    if (src != (char *) base) {
+        memcpy(base, src, count * elem_size);
+    }
+    return true;
+}
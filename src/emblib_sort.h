@@ -0,0 +1,33 @@
+#ifndef __EMBLIB_SORT_H__
+#define __EMBLIB_SORT_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Sorts an array in place (introsort: quicksort with median of three, falling back to
+ *        heapsort on bad partitions and to insertion sort on small ranges). Not stable.
+ *
+ * @param[in,out] base Pointer to the first element.
+ * @param[in] count Number of elements.
+ * @param[in] elem_size Size of each element in bytes.
+ * @param[in] cmp_fn Comparator, returns < 0 when left goes before right, 0 when equal, > 0 otherwise.
+ */
+void emblib_sort(void *base, size_t count, size_t elem_size, int (*cmp_fn)(void *left, void *right));
+
+/**
+ * @brief Sorts an array of integers in ascending order (LSD radix sort, one pass per key byte,
+ *        skipping the bytes that are equal for every key). Stable.
+ *
+ * @param[in,out] base Pointer to the first element.
+ * @param[in] count Number of elements.
+ * @param[in] elem_size Size of each element in bytes, 4 or 8.
+ * @param[in] is_signed true for two's complement keys, false for unsigned keys.
+ * @param[in] scratch Pointer to a scratch area of at least count * elem_size bytes.
+ * @param[in] scratch_len Size in bytes of scratch.
+ * @return true on success, false on invalid parameters.
+ */
+bool emblib_radix_sort(void *base, size_t count, size_t elem_size, bool is_signed, void *scratch,
+                       size_t scratch_len);
+
+#endif //__EMBLIB_SORT_H__
@@ -15,16 +15,57 @@ size_t emblib_stack_count(emblib_stack_t *stack) {
     return emblib_circ_buffer_count(stack);
 }
 
+static char *stack_top(emblib_stack_t *stack) {
+    return (char *) stack->array + (stack->count - 1) * stack->elem_size;
+}
+
 bool emblib_stack_push(emblib_stack_t *stack, void *data) {
-    return emblib_circ_buffer_insert(stack, data);
+    bool bRet = false;
+    if (stack && data && !emblib_stack_is_full(stack)) {
+        stack->copy_fn((char *) stack->array + stack->count * stack->elem_size, data);
+        stack->count++;
+        bRet = true;
+    }
+    return bRet;
 }
 
 bool emblib_stack_pop(emblib_stack_t *stack, void *data) {
-    return emblib_circ_buffer_retrieve(stack, data);
+    bool bRet = false;
+    if (stack && data && !emblib_stack_is_empty(stack)) {
+        stack->copy_fn(data, stack_top(stack));
+        stack->count--;
+        bRet = true;
+    }
+    return bRet;
+}
+
+bool emblib_stack_push_n(emblib_stack_t *stack, void *data, size_t n) {
+    bool bRet = false;
+    if (stack && data && n <= emblib_stack_size(stack) - emblib_stack_count(stack)) {
+        memcpy((char *) stack->array + stack->count * stack->elem_size, data, n * stack->elem_size);
+        stack->count += n;
+        bRet = true;
+    }
+    return bRet;
+}
+
+bool emblib_stack_pop_n(emblib_stack_t *stack, void *data, size_t n) {
+    bool bRet = false;
+    if (stack && data && n <= emblib_stack_count(stack)) {
+        stack->count -= n;
+        memcpy(data, (char *) stack->array + stack->count * stack->elem_size, n * stack->elem_size);
+        bRet = true;
+    }
+    return bRet;
 }
 
 bool emblib_stack_peek(emblib_stack_t *stack, void *data) {
-    return emblib_circ_buffer_peek(stack, data);
+    bool bRet = false;
+    if (stack && data && !emblib_stack_is_empty(stack)) {
+        stack->copy_fn(data, stack_top(stack));
+        bRet = true;
+    }
+    return bRet;
 }
 
 bool emblib_stack_is_full(emblib_stack_t *stack) {
@@ -10,6 +10,7 @@
 #include "emblib_circ_buffer.h"
 
 //! @struct emblib_stack_t
+//! array stack: count is the top index, elements never wrap (head and tail stay 0)
 typedef emblib_circ_buffer_t emblib_stack_t;
 
 /**
@@ -56,6 +57,28 @@ bool emblib_stack_push(emblib_stack_t *stack, void *data);
  */
 bool emblib_stack_pop(emblib_stack_t *stack, void *data);
 
+/**
+ *  @brief          push n elements with one block copy (memcpy, copy_fn is not called),
+ *                  data[n - 1] becomes the top
+ *  @param[inout]   stack pointer to the stack object
+ *  @param[in]      data pointer to the elements to be saved
+ *  @param[in]      n number of elements
+ *  @returns        true on success
+ *  @returns        false when the stack has no room for n elements (nothing is pushed)
+ */
+bool emblib_stack_push_n(emblib_stack_t *stack, void *data, size_t n);
+
+/**
+ *  @brief          pop the n top elements with one block copy, in stack order:
+ *                  data[n - 1] receives the former top
+ *  @param[inout]   stack pointer to the stack object
+ *  @param[out]     data pointer to the memory for the n elements
+ *  @param[in]      n number of elements
+ *  @returns        true on success
+ *  @returns        false when the stack holds less than n elements (nothing is popped)
+ */
+bool emblib_stack_pop_n(emblib_stack_t *stack, void *data, size_t n);
+
 /**
  *  @brief          get a element from the end of the queue, but do not remove them
  *  @param[inout]   queue pointer to the queue object
@@ -0,0 +1,256 @@
+#include "emblib_swiss_set.h"
+#include "emblib_util.h"
+#include <string.h>
+
+#if !defined(EMBLIB_SWISS_SET_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#define SWISS_SET_SSE2
+#include <emmintrin.h>
+#elif !defined(EMBLIB_SWISS_SET_NO_SIMD) && defined(__ARM_NEON) && defined(__aarch64__)
+#define SWISS_SET_NEON
+#include <arm_neon.h>
+#endif
+
+#define CTRL_EMPTY   ((uint8_t) 0x80)
+#define CTRL_DELETED ((uint8_t) 0xFE)
+
+#define IS_FULL(c)   (((c) & 0x80) == 0)
+
+// =============================================================================
+// GROUP MATCHING: bit i of the result is set when control byte i matches
+// =============================================================================
+
+#if defined(SWISS_SET_SSE2)
+
+static inline uint32_t group_match(const uint8_t *ctrl, uint8_t value) {
+    const __m128i group = _mm_loadu_si128((const __m128i *) ctrl);
+    return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char) value)));
+}
+
+static inline uint32_t group_match_free(const uint8_t *ctrl) {
+    // empty and deleted are the only control bytes with the high bit set
+    return (uint32_t) _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) ctrl));
+}
+
+#elif defined(SWISS_SET_NEON)
+
+static inline uint32_t neon_movemask(uint8x16_t bytes) {
+    static const uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t bits = vandq_u8(bytes, vld1q_u8(weights));
+    return (uint32_t) vaddv_u8(vget_low_u8(bits)) | ((uint32_t) vaddv_u8(vget_high_u8(bits)) << 8);
+}
+
+static inline uint32_t group_match(const uint8_t *ctrl, uint8_t value) {
+    return neon_movemask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(value)));
+}
+
+static inline uint32_t group_match_free(const uint8_t *ctrl) {
+    return neon_movemask(vtstq_u8(vld1q_u8(ctrl), vdupq_n_u8(0x80)));
+}
+
+#else
+
+static inline uint32_t group_match(const uint8_t *ctrl, uint8_t value) {
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < EMBLIB_SWISS_SET_GROUP; i++) {
+        mask |= (uint32_t) (ctrl[i] == value) << i;
+    }
+    return mask;
+}
+
+static inline uint32_t group_match_free(const uint8_t *ctrl) {
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < EMBLIB_SWISS_SET_GROUP; i++) {
+        mask |= (uint32_t) (ctrl[i] >> 7) << i;
+    }
+    return mask;
+}
+
+#endif
+
+// =============================================================================
+// PROBING: triangular sequence over groups aligned on 16 slots
+// =============================================================================
+
+static char *swiss_set_slot(emblib_swiss_set_t *set, size_t index) {
+    return (char *) set->array + index * set->elem_size;
+}
+
+static uint8_t swiss_set_h2(uint64_t hash) {
+    return (uint8_t) (hash & 0x7F);
+}
+
+static size_t swiss_set_h1(emblib_swiss_set_t *set, uint64_t hash) {
+    return (size_t) (hash >> 7) & (set->capacity / EMBLIB_SWISS_SET_GROUP - 1);
+}
+
+static bool swiss_set_find(emblib_swiss_set_t *set, void *data, uint64_t hash, size_t *pos) {
+    const size_t groups = set->capacity / EMBLIB_SWISS_SET_GROUP;
+    const uint8_t h2 = swiss_set_h2(hash);
+    size_t group = swiss_set_h1(set, hash);
+
+    for (size_t step = 1; step <= groups; step++) {
+        const uint8_t *ctrl = set->ctrl + group * EMBLIB_SWISS_SET_GROUP;
+
+        for (uint32_t mask = group_match(ctrl, h2); mask; mask &= mask - 1) {
+            const size_t index = group * EMBLIB_SWISS_SET_GROUP + emblib_ctz32(mask);
+            if (set->cmp_fn(swiss_set_slot(set, index), data) == 0) {
+                *pos = index;
+                return true;
+            }
+        }
+        if (group_match(ctrl, CTRL_EMPTY)) break;
+
+        group = (group + step) & (groups - 1);
+    }
+    return false;
+}
+
+/**
+ * @brief first empty or deleted slot of the probe sequence of hash
+ */
+static size_t swiss_set_find_free(emblib_swiss_set_t *set, uint64_t hash) {
+    const size_t groups = set->capacity / EMBLIB_SWISS_SET_GROUP;
+    size_t group = swiss_set_h1(set, hash);
+
+    for (size_t step = 1;; step++) {
+        const uint32_t mask = group_match_free(set->ctrl + group * EMBLIB_SWISS_SET_GROUP);
+        if (mask) return group * EMBLIB_SWISS_SET_GROUP + emblib_ctz32(mask);
+
+        group = (group + step) & (groups - 1);
+    }
+}
+
+/**
+ * @brief rehash in place to turn the deleted slots back into empty ones
+ */
+static void swiss_set_drop_deleted(emblib_swiss_set_t *set) {
+    char tmp[set->elem_size];
+
+    // deleted become empty, full become deleted (= still to be placed)
+    for (size_t i = 0; i < set->capacity; i++) {
+        set->ctrl[i] = IS_FULL(set->ctrl[i]) ? CTRL_DELETED : CTRL_EMPTY;
+    }
+
+    for (size_t i = 0; i < set->capacity; i++) {
+        if (set->ctrl[i] != CTRL_DELETED) continue;
+
+        const uint64_t hash = set->hash_fn(swiss_set_slot(set, i));
+        const size_t target = swiss_set_find_free(set, hash);
+
+        if (target / EMBLIB_SWISS_SET_GROUP == i / EMBLIB_SWISS_SET_GROUP) {
+            set->ctrl[i] = swiss_set_h2(hash);
+        } else if (set->ctrl[target] == CTRL_EMPTY) {
+            memcpy(swiss_set_slot(set, target), swiss_set_slot(set, i), set->elem_size);
+            set->ctrl[target] = swiss_set_h2(hash);
+            set->ctrl[i] = CTRL_EMPTY;
+        } else {
+            // the target still holds an element to be placed: swap and process slot i again
+            memcpy(tmp, swiss_set_slot(set, target), set->elem_size);
+            memcpy(swiss_set_slot(set, target), swiss_set_slot(set, i), set->elem_size);
+            memcpy(swiss_set_slot(set, i), tmp, set->elem_size);
+            set->ctrl[target] = swiss_set_h2(hash);
+            i--;
+        }
+    }
+    set->growth_left = set->max_count - set->count;
+}
+
+bool emblib_swiss_set_init(emblib_swiss_set_t *set, void *array, size_t buffer_len, size_t size_elem,
+                           void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
+                           int (*cmp_fn)(void *right, void *left), uint64_t (*hash_fn)(void *data)) {
+    if (!set || !array || !size_elem || !copy_fn || !cmp_fn || !hash_fn) return false;
+
+    size_t capacity = EMBLIB_SWISS_SET_GROUP;
+    if (capacity * (size_elem + 1) > buffer_len) return false;
+    while (capacity * 2 <= buffer_len / (size_elem + 1)) {
+        capacity *= 2;
+    }
+
+    *set = (emblib_swiss_set_t) {
+            .array       = array,
+            .ctrl        = (uint8_t *) array + capacity * size_elem,
+            .capacity    = capacity,
+            .max_count   = capacity - capacity / 8,
+            .growth_left = capacity - capacity / 8,
+            .count       = 0,
+            .elem_size   = size_elem,
+            .copy_fn     = copy_fn,
+            .free_fn     = free_fn,
+            .cmp_fn      = cmp_fn,
+            .hash_fn     = hash_fn
+    };
+    memset(set->ctrl, CTRL_EMPTY, capacity);
+    return true;
+}
+
+bool emblib_swiss_set_add(emblib_swiss_set_t *set, void *data) {
+    if (!set || !data || emblib_swiss_set_is_full(set)) return false;
+
+    const uint64_t hash = set->hash_fn(data);
+    size_t pos;
+    if (swiss_set_find(set, data, hash, &pos)) return false;
+
+    pos = swiss_set_find_free(set, hash);
+    if (set->ctrl[pos] == CTRL_EMPTY && set->growth_left == 0) {
+        swiss_set_drop_deleted(set);
+        pos = swiss_set_find_free(set, hash);
+    }
+
+    if (set->ctrl[pos] == CTRL_EMPTY) set->growth_left--;
+    set->copy_fn(swiss_set_slot(set, pos), data);
+    set->ctrl[pos] = swiss_set_h2(hash);
+    set->count++;
+    return true;
+}
+
+bool emblib_swiss_set_remove(emblib_swiss_set_t *set, void *data) {
+    if (!set || !data || !set->count) return false;
+
+    size_t pos;
+    if (!swiss_set_find(set, data, set->hash_fn(data), &pos)) return false;
+
+    // with aligned groups, no probe sequence goes past a group that still has an empty slot
+    const uint8_t *group = set->ctrl + (pos / EMBLIB_SWISS_SET_GROUP) * EMBLIB_SWISS_SET_GROUP;
+    if (group_match(group, CTRL_EMPTY)) {
+        set->ctrl[pos] = CTRL_EMPTY;
+        set->growth_left++;
+    } else {
+        set->ctrl[pos] = CTRL_DELETED;
+    }
+    set->count--;
+    return true;
+}
+
+bool emblib_swiss_set_contains(emblib_swiss_set_t *set, void *data) {
+    if (!set || !data || !set->count) return false;
+
+    size_t pos;
+    return swiss_set_find(set, data, set->hash_fn(data), &pos);
+}
+
+size_t emblib_swiss_set_size(emblib_swiss_set_t *set) {
+    return set ? set->max_count : 0;
+}
+
+size_t emblib_swiss_set_count(emblib_swiss_set_t *set) {
+    return set ? set->count : 0;
+}
+
+void emblib_swiss_set_flush(emblib_swiss_set_t *set) {
+    if (set) {
+        for (size_t i = 0; i < set->capacity && set->free_fn; i++) {
+            if (IS_FULL(set->ctrl[i])) set->free_fn(swiss_set_slot(set, i));
+        }
+        memset(set->ctrl, CTRL_EMPTY, set->capacity);
+        set->growth_left = set->max_count;
+        set->count = 0;
+    }
+}
+
+bool emblib_swiss_set_is_full(emblib_swiss_set_t *set) {
+    return set ? set->count >= set->max_count : false;
+}
+
+bool emblib_swiss_set_is_empty(emblib_swiss_set_t *set) {
+    return set ? set->count == 0 : false;
+}
@@ -0,0 +1,101 @@
+#ifndef __EMB_LIB_EMBLIB_SWISS_SET_H__
+#define __EMB_LIB_EMBLIB_SWISS_SET_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+//! slots probed at once
+#define EMBLIB_SWISS_SET_GROUP 16
+
+/**
+ * @brief Hash set with one control byte per slot (7 bits of hash for a full slot, or the
+ *        empty/deleted markers). Lookups scan a group of 16 control bytes at once (SSE2 or
+ *        NEON when available, define EMBLIB_SWISS_SET_NO_SIMD to force the portable code)
+ *        and only call cmp_fn for slots whose 7 hash bits match.
+ *        The caller buffer holds the slots followed by the control bytes; the number of
+ *        slots is the largest power of two (at least 16) that fits.
+ */
+typedef struct _emblib_swiss_set_t {
+    void *array;            //!< slots
+    uint8_t *ctrl;          //!< control byte of each slot
+    size_t capacity;        //!< number of slots
+    size_t max_count;       //!< maximum number of elements (7/8 of the slots)
+    size_t growth_left;     //!< empty slots that can still be used before cleaning the deleted ones
+    size_t count;           //!< number of elements stored
+    size_t elem_size;       //!< size of each element
+    void (*copy_fn)(void *dest, void *src); //! copy function
+    void (*free_fn)(void *data);            //! free function
+    int (*cmp_fn)(void *right, void *left); //! compare function, 0 when equal
+    uint64_t (*hash_fn)(void *data);        //! hash function
+} emblib_swiss_set_t;
+
+/**
+ * @brief Initializes the set.
+ *
+ * @param set Pointer to the set structure.
+ * @param array Pointer to the memory where elements will be stored.
+ * @param buffer_len Size in bytes of array, at least 16 * (size_elem + 1).
+ * @param size_elem Size of each element in bytes.
+ * @param hash_fn Hash function. Equal elements must have the same hash.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_swiss_set_init(emblib_swiss_set_t *set, void *array, size_t buffer_len, size_t size_elem,
+                           void (*copy_fn)(void *dest, void *src), void (*free_fn)(void *data),
+                           int (*cmp_fn)(void *right, void *left), uint64_t (*hash_fn)(void *data));
+
+/**
+ * @brief Adds an element to the set.
+ *
+ * @param set Pointer to the set structure.
+ * @param data Pointer to the element to be added.
+ * @return true if the add is successful, false if the element already exists or the set is full.
+ */
+bool emblib_swiss_set_add(emblib_swiss_set_t *set, void *data);
+
+/**
+ * @brief Removes an element from the set.
+ *
+ * @param set Pointer to the set structure.
+ * @param data Pointer to the element to be removed.
+ * @return true if the remove is successful, false otherwise.
+ */
+bool emblib_swiss_set_remove(emblib_swiss_set_t *set, void *data);
+
+/**
+ * @brief Checks if the set contains a specific element.
+ *
+ * @param set Pointer to the set structure.
+ * @param data Pointer to the element to check.
+ * @return true if the set contains the element, false otherwise.
+ */
+bool emblib_swiss_set_contains(emblib_swiss_set_t *set, void *data);
+
+/**
+ * @brief Returns the maximum number of elements of the set.
+ *
+ * @param set Pointer to the set structure.
+ * @return Maximum number of elements.
+ */
+size_t emblib_swiss_set_size(emblib_swiss_set_t *set);
+
+/**
+ * @brief Returns the number of elements currently stored in the set.
+ *
+ * @param set Pointer to the set structure.
+ * @return Number of elements in the set.
+ */
+size_t emblib_swiss_set_count(emblib_swiss_set_t *set);
+
+/**
+ * @brief Clears all elements from the set.
+ *
+ * @param set Pointer to the set structure.
+ */
+void emblib_swiss_set_flush(emblib_swiss_set_t *set);
+
+bool emblib_swiss_set_is_full(emblib_swiss_set_t *set);
+
+bool emblib_swiss_set_is_empty(emblib_swiss_set_t *set);
+
+#endif //__EMB_LIB_EMBLIB_SWISS_SET_H__
@@ -186,6 +186,102 @@ static inline const char* emblib_thread_backend(void) {
 #endif
 }
 
+// =============================================================================
+// LOCK-FREE PRIMITIVES
+// =============================================================================
+
+/**
+ * Atomic operations on plain integer and pointer objects, available whatever the
+ * backend above: the lock-free containers need them even when the mutex macros are
+ * no-ops. GCC/Clang __atomic builtins, else C23 <stdatomic.h> (typeof is needed to
+ * reach the atomic type of the object). There is no non-atomic fallback: it would
+ * silently break the lock-free algorithms.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+    #define EMBLIB_LF_RELAXED __ATOMIC_RELAXED
+    #define EMBLIB_LF_ACQUIRE __ATOMIC_ACQUIRE
+    #define EMBLIB_LF_RELEASE __ATOMIC_RELEASE
+    #define EMBLIB_LF_ACQ_REL __ATOMIC_ACQ_REL
+    #define EMBLIB_LF_SEQ_CST __ATOMIC_SEQ_CST
+
+    #define EMBLIB_LF_LOAD(ptr, order) __atomic_load_n(ptr, order)
+    #define EMBLIB_LF_STORE(ptr, val, order) __atomic_store_n(ptr, val, order)
+    #define EMBLIB_LF_FETCH_ADD(ptr, val, order) __atomic_fetch_add(ptr, val, order)
+    #define EMBLIB_LF_CAS(ptr, expected, desired, success_order, failure_order) \
+        __atomic_compare_exchange_n(ptr, expected, desired, false, success_order, failure_order)
+    #define EMBLIB_LF_FENCE(order) __atomic_thread_fence(order)
+    #if defined(__x86_64__) || defined(__i386__)
+        #define EMBLIB_LF_CPU_RELAX() __builtin_ia32_pause()
+    #elif defined(__aarch64__) || (defined(__arm__) && __ARM_ARCH >= 7)
+        #define EMBLIB_LF_CPU_RELAX() __asm__ __volatile__("yield")
+    #else
+        #define EMBLIB_LF_CPU_RELAX() do {} while(0)
+    #endif
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 202311L && !defined(__STDC_NO_ATOMICS__)
+    #include <stdatomic.h>
+
+    #define EMBLIB_LF_RELAXED memory_order_relaxed
+    #define EMBLIB_LF_ACQUIRE memory_order_acquire
+    #define EMBLIB_LF_RELEASE memory_order_release
+    #define EMBLIB_LF_ACQ_REL memory_order_acq_rel
+    #define EMBLIB_LF_SEQ_CST memory_order_seq_cst
+
+    // the objects are plain integers and pointers, lock-free types have the same representation
+    #define EMBLIB_LF_ATOMIC(ptr) ((_Atomic(typeof(*(ptr))) *) (ptr))
+
+    #define EMBLIB_LF_LOAD(ptr, order) atomic_load_explicit(EMBLIB_LF_ATOMIC(ptr), order)
+    #define EMBLIB_LF_STORE(ptr, val, order) atomic_store_explicit(EMBLIB_LF_ATOMIC(ptr), val, order)
+    #define EMBLIB_LF_FETCH_ADD(ptr, val, order) atomic_fetch_add_explicit(EMBLIB_LF_ATOMIC(ptr), val, order)
+    #define EMBLIB_LF_CAS(ptr, expected, desired, success_order, failure_order) \
+        atomic_compare_exchange_strong_explicit(EMBLIB_LF_ATOMIC(ptr), expected, desired, \
+                                                success_order, failure_order)
+    #define EMBLIB_LF_FENCE(order) atomic_thread_fence(order)
+    #define EMBLIB_LF_CPU_RELAX() do {} while(0)
+#else
+    #error "emblib_thread_safety.h: no atomic primitives (GCC/Clang __atomic builtins or C23 <stdatomic.h>)"
+#endif
+
+/**
+ * @brief Sequence lock: readers never write shared memory, they retry when a writer
+ *        ran meanwhile. Odd while a writer is inside. Writers exclude each other with
+ *        a CAS on the sequence, so it also works where the mutex macros are no-ops.
+ *
+ * Usage:
+ * do {
+ *     seq = emblib_seqlock_read_begin(&lock);
+ *     // copy the protected data, no side effects
+ * } while (emblib_seqlock_read_retry(&lock, seq));
+ */
+typedef unsigned emblib_seqlock_t;
+
+static inline unsigned emblib_seqlock_read_begin(emblib_seqlock_t *lock) {
+    unsigned seq;
+    while ((seq = EMBLIB_LF_LOAD(lock, EMBLIB_LF_ACQUIRE)) & 1u) {
+        EMBLIB_LF_CPU_RELAX();
+    }
+    return seq;
+}
+
+static inline bool emblib_seqlock_read_retry(emblib_seqlock_t *lock, unsigned seq) {
+    EMBLIB_LF_FENCE(EMBLIB_LF_ACQUIRE);
+    return EMBLIB_LF_LOAD(lock, EMBLIB_LF_RELAXED) != seq;
+}
+
+static inline void emblib_seqlock_write_lock(emblib_seqlock_t *lock) {
+    unsigned seq = EMBLIB_LF_LOAD(lock, EMBLIB_LF_RELAXED);
+    for (;;) {
+        if (!(seq & 1u) && EMBLIB_LF_CAS(lock, &seq, seq + 1, EMBLIB_LF_ACQUIRE, EMBLIB_LF_RELAXED)) break;
+        EMBLIB_LF_CPU_RELAX();
+        seq = EMBLIB_LF_LOAD(lock, EMBLIB_LF_RELAXED);
+    }
+    // the odd sequence must be visible before any store to the protected data
+    EMBLIB_LF_FENCE(EMBLIB_LF_RELEASE);
+}
+
+static inline void emblib_seqlock_write_unlock(emblib_seqlock_t *lock) {
+    EMBLIB_LF_STORE(lock, EMBLIB_LF_LOAD(lock, EMBLIB_LF_RELAXED) + 1, EMBLIB_LF_RELEASE);
+}
+
 // =============================================================================
 // FUTURE EXTENSIONS
 // =============================================================================
@@ -195,7 +291,6 @@ static inline const char* emblib_thread_backend(void) {
  * - Reader-writer locks
  * - Condition variables
  * - Thread-local storage
- * - Memory barriers
  */
 
 #ifdef __cplusplus
@@ -0,0 +1,130 @@
+#include "emblib_timer_wheel.h"
+
+#define WHEEL_MASK (EMBLIB_TIMER_WHEEL_SLOTS - 1)
+#define WHEEL_RANGE ((uint64_t) 1 << (EMBLIB_TIMER_WHEEL_BITS * EMBLIB_TIMER_WHEEL_LEVELS))
+
+static emblib_timer_t *wheel_timer(emblib_timer_wheel_t *wheel, emblib_ilist_index_t handle) {
+    return (emblib_timer_t *) emblib_ilist_pool_elem(&wheel->pool, handle);
+}
+
+/**
+ * @brief link the timer into the finest level covering its delay
+ */
+static void wheel_place(emblib_timer_wheel_t *wheel, emblib_ilist_index_t handle) {
+    emblib_timer_t *timer = wheel_timer(wheel, handle);
+    const uint64_t delta = timer->expires - wheel->now;
+
+    // beyond the range: park at the farthest slot, placed again when it is cascaded
+    const uint64_t expires = delta < WHEEL_RANGE ? timer->expires : wheel->now + WHEEL_RANGE - 1;
+
+    size_t level = 0;
+    while (level < EMBLIB_TIMER_WHEEL_LEVELS - 1 &&
+           expires - wheel->now >= (uint64_t) 1 << (EMBLIB_TIMER_WHEEL_BITS * (level + 1))) {
+        level++;
+    }
+    const size_t slot = (size_t) (expires >> (EMBLIB_TIMER_WHEEL_BITS * level)) & WHEEL_MASK;
+
+    timer->slot = (uint16_t) (level * EMBLIB_TIMER_WHEEL_SLOTS + slot);
+    emblib_ilist_push_back(&wheel->slots[timer->slot], handle);
+}
+
+/**
+ * @brief move the timers of a coarse slot down to the finer levels
+ */
+static void wheel_cascade(emblib_timer_wheel_t *wheel, size_t level, size_t slot) {
+    emblib_ilist_t pending;
+    emblib_ilist_init(&pending, &wheel->pool);
+    emblib_ilist_splice(&pending, EMBLIB_ILIST_NIL, &wheel->slots[level * EMBLIB_TIMER_WHEEL_SLOTS + slot]);
+
+    emblib_ilist_index_t handle;
+    while ((handle = emblib_ilist_front(&pending)) != EMBLIB_ILIST_NIL) {
+        emblib_ilist_remove(&pending, handle);
+        wheel_place(wheel, handle);
+    }
+}
+
+bool emblib_timer_wheel_init(emblib_timer_wheel_t *wheel, emblib_timer_t *timers, size_t buffer_len) {
+    if (!wheel || !timers) return false;
+
+    if (!emblib_ilist_pool_init(&wheel->pool, timers, buffer_len, sizeof(emblib_timer_t),
+                                offsetof(emblib_timer_t, node))) {
+        return false;
+    }
+    for (size_t i = 0; i < EMBLIB_TIMER_WHEEL_LEVELS * EMBLIB_TIMER_WHEEL_SLOTS; i++) {
+        emblib_ilist_init(&wheel->slots[i], &wheel->pool);
+    }
+    // a free timer is in no slot: cancel of a stale handle is rejected
+    for (size_t i = 0; i < wheel->pool.capacity; i++) {
+        timers[i].slot = UINT16_MAX;
+    }
+    wheel->now = 0;
+    return true;
+}
+
+emblib_ilist_index_t emblib_timer_wheel_start(emblib_timer_wheel_t *wheel, uint64_t delay, void (*fn)(void *arg),
+                                              void *arg) {
+    if (!wheel || !fn) return EMBLIB_ILIST_NIL;
+
+    const emblib_ilist_index_t handle = emblib_ilist_pool_alloc(&wheel->pool);
+    if (handle == EMBLIB_ILIST_NIL) return EMBLIB_ILIST_NIL;
+
+    emblib_timer_t *timer = wheel_timer(wheel, handle);
+    timer->expires = wheel->now + (delay ? delay : 1);
+    timer->fn = fn;
+    timer->arg = arg;
+    wheel_place(wheel, handle);
+    return handle;
+}
+
+bool emblib_timer_wheel_cancel(emblib_timer_wheel_t *wheel, emblib_ilist_index_t handle) {
+    if (!wheel || handle == EMBLIB_ILIST_NIL || handle >= wheel->pool.capacity) return false;
+
+    emblib_timer_t *timer = wheel_timer(wheel, handle);
+    if (timer->slot >= EMBLIB_TIMER_WHEEL_LEVELS * EMBLIB_TIMER_WHEEL_SLOTS ||
+        !emblib_ilist_remove(&wheel->slots[timer->slot], handle)) {
+        return false;
+    }
+    timer->slot = UINT16_MAX;
+    emblib_ilist_pool_free(&wheel->pool, handle);
+    return true;
+}
+
+size_t emblib_timer_wheel_tick(emblib_timer_wheel_t *wheel) {
+    if (!wheel) return 0;
+
+    wheel->now++;
+
+    // level 0 wrapped: bring down the next slot of level 1, and further while levels wrap too
+    if (!(wheel->now & WHEEL_MASK)) {
+        for (size_t level = 1; level < EMBLIB_TIMER_WHEEL_LEVELS; level++) {
+            const size_t slot = (size_t) (wheel->now >> (EMBLIB_TIMER_WHEEL_BITS * level)) & WHEEL_MASK;
+            wheel_cascade(wheel, level, slot);
+            if (slot) break;
+        }
+    }
+
+    emblib_ilist_t *due = &wheel->slots[wheel->now & WHEEL_MASK];
+    size_t fired = 0;
+    emblib_ilist_index_t handle;
+    while ((handle = emblib_ilist_front(due)) != EMBLIB_ILIST_NIL) {
+        emblib_timer_t *timer = wheel_timer(wheel, handle);
+        void (*fn)(void *arg) = timer->fn;
+        void *arg = timer->arg;
+
+        // released first, so that the callback can start a timer on the same node
+        emblib_ilist_remove(due, handle);
+        timer->slot = UINT16_MAX;
+        emblib_ilist_pool_free(&wheel->pool, handle);
+        fn(arg);
+        fired++;
+    }
+    return fired;
+}
+
+uint64_t emblib_timer_wheel_now(emblib_timer_wheel_t *wheel) {
+    return wheel ? wheel->now : 0;
+}
+
+size_t emblib_timer_wheel_count(emblib_timer_wheel_t *wheel) {
+    return wheel ? wheel->pool.capacity - emblib_ilist_pool_available(&wheel->pool) : 0;
+}
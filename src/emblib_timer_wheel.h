@@ -0,0 +1,97 @@
+#ifndef __EMB_LIB_EMBLIB_TIMER_WHEEL_H__
+#define __EMB_LIB_EMBLIB_TIMER_WHEEL_H__
+
+#include "emblib_ilist.h"
+
+#ifndef EMBLIB_TIMER_WHEEL_LEVELS
+//! number of wheels, each one EMBLIB_TIMER_WHEEL_SLOTS times coarser than the previous
+#define EMBLIB_TIMER_WHEEL_LEVELS 4
+#endif
+
+//! log2 of the slots per wheel
+#define EMBLIB_TIMER_WHEEL_BITS 6
+//! slots per wheel
+#define EMBLIB_TIMER_WHEEL_SLOTS (1u << EMBLIB_TIMER_WHEEL_BITS)
+
+/**
+ * @brief Timer node, allocated from the pool of the wheel.
+ */
+typedef struct _emblib_timer_t {
+    emblib_ilist_node_t node;   //!< link in its slot
+    uint64_t expires;           //!< tick at which the timer fires
+    void (*fn)(void *arg);      //!< callback
+    void *arg;                  //!< callback argument
+    uint16_t slot;              //!< level * EMBLIB_TIMER_WHEEL_SLOTS + slot holding the timer
+} emblib_timer_t;
+
+/**
+ * @brief Hierarchical timing wheel. Level 0 has one slot per tick for the next 64 ticks, level 1
+ *        one slot per 64 ticks for the next 64^2, and so on. A timer is put in the finest level
+ *        that covers its delay, O(1); when a level wraps, the next coarser slot is cascaded
+ *        down. Each timer moves at most LEVELS - 1 times, so a tick is amortized O(1) whatever
+ *        the number of timers. Delays beyond 64^LEVELS ticks are parked in the last level and
+ *        placed again when it comes round.
+ *        Timers live in a caller array managed by an emblib_ilist_pool_t, slots are emblib_ilist_t.
+ */
+typedef struct _emblib_timer_wheel_t {
+    emblib_ilist_pool_t pool;   //!< timers
+    emblib_ilist_t slots[EMBLIB_TIMER_WHEEL_LEVELS * EMBLIB_TIMER_WHEEL_SLOTS];  //!< timers of each slot
+    uint64_t now;               //!< current tick
+} emblib_timer_wheel_t;
+
+/**
+ * @brief Initializes the wheel at tick 0.
+ *
+ * @param[in,out] wheel Pointer to the wheel structure.
+ * @param[in] timers Array of timers.
+ * @param[in] buffer_len Size in bytes of timers.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_timer_wheel_init(emblib_timer_wheel_t *wheel, emblib_timer_t *timers, size_t buffer_len);
+
+/**
+ * @brief Starts a timer, O(1).
+ *
+ * @param[in,out] wheel Pointer to the wheel structure.
+ * @param[in] delay Number of ticks before the timer fires, at least 1.
+ * @param[in] fn Callback, run from emblib_timer_wheel_tick. It may start and cancel timers.
+ * @param[in] arg Callback argument.
+ * @return handle of the timer, valid until it fires or is cancelled; EMBLIB_ILIST_NIL if no timer is free.
+ */
+emblib_ilist_index_t emblib_timer_wheel_start(emblib_timer_wheel_t *wheel, uint64_t delay, void (*fn)(void *arg),
+                                              void *arg);
+
+/**
+ * @brief Cancels a pending timer, O(1).
+ *
+ * @param[in,out] wheel Pointer to the wheel structure.
+ * @param[in] handle Handle returned by emblib_timer_wheel_start.
+ * @return true if the timer was pending, false otherwise.
+ */
+bool emblib_timer_wheel_cancel(emblib_timer_wheel_t *wheel, emblib_ilist_index_t handle);
+
+/**
+ * @brief Advances the wheel by one tick and runs the callbacks of the timers that expire.
+ *
+ * @param[in,out] wheel Pointer to the wheel structure.
+ * @return number of timers fired.
+ */
+size_t emblib_timer_wheel_tick(emblib_timer_wheel_t *wheel);
+
+/**
+ * @brief Returns the current tick.
+ *
+ * @param[in] wheel Pointer to the wheel structure.
+ * @return current tick.
+ */
+uint64_t emblib_timer_wheel_now(emblib_timer_wheel_t *wheel);
+
+/**
+ * @brief Returns the number of pending timers.
+ *
+ * @param[in] wheel Pointer to the wheel structure.
+ * @return number of pending timers.
+ */
+size_t emblib_timer_wheel_count(emblib_timer_wheel_t *wheel);
+
+#endif //__EMB_LIB_EMBLIB_TIMER_WHEEL_H__
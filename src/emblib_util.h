@@ -3,6 +3,7 @@
 
 #include <inttypes.h>
 #include <stddef.h>
+#include <stdint.h>
 
 
 #define ARRAY_LEN(x) (sizeof(x)/sizeof(x[0]))
@@ -59,4 +60,58 @@ uint32_t MAKEDWORD(const uint16_t lo, const uint16_t hi);
 uint8_t *memrev(uint8_t *p, const size_t len);
 
 
+/**
+ *  @brief      count the bits set of a word
+ *  @param[in]  x input word
+ *  @return     number of bits set
+ */
+static inline uint32_t emblib_popcount32(uint32_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t) __builtin_popcount(x);
+#else
+    x = x - ((x >> 1) & 0x55555555u);
+    x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+    return (((x + (x >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+#endif
+}
+
+/**
+ *  @brief      count the trailing zero bits of a word (index of the lowest bit set)
+ *  @param[in]  x input word
+ *  @return     number of trailing zeros, 32 when x is 0
+ */
+static inline uint32_t emblib_ctz32(uint32_t x) {
+    if (!x) return 32;
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t) __builtin_ctz(x);
+#else
+    uint32_t n = 0;
+    while (!(x & 1u)) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ *  @brief      count the leading zero bits of a word (31 - index of the highest bit set)
+ *  @param[in]  x input word
+ *  @return     number of leading zeros, 32 when x is 0
+ */
+static inline uint32_t emblib_clz32(uint32_t x) {
+    if (!x) return 32;
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t) __builtin_clz(x);
+#else
+    uint32_t n = 0;
+    while (!(x & 0x80000000u)) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+
 #endif //~__EMBLIB_UTIL_H__
@@ -0,0 +1,97 @@
+#include "emblib_ws_deque.h"
+#include "emblib_thread_safety.h"
+#include <string.h>
+
+static char *ws_deque_slot(emblib_ws_deque_t *deque, int64_t index) {
+    return (char *) deque->array + ((size_t) index & deque->mask) * deque->elem_size;
+}
+
+bool emblib_ws_deque_init(emblib_ws_deque_t *deque, void *array, size_t buffer_len, size_t size_elem) {
+    if (!deque || !array || !size_elem || buffer_len / size_elem < 1) return false;
+
+    size_t capacity = 1;
+    while (capacity * 2 <= buffer_len / size_elem) {
+        capacity *= 2;
+    }
+
+    deque->array = array;
+    deque->mask = capacity - 1;
+    deque->elem_size = size_elem;
+    deque->top = 0;
+    deque->bottom = 0;
+    return true;
+}
+
+bool emblib_ws_deque_push(emblib_ws_deque_t *deque, void *data) {
+    if (!deque || !data) return false;
+
+    const int64_t b = EMBLIB_LF_LOAD(&deque->bottom, EMBLIB_LF_RELAXED);
+    const int64_t t = EMBLIB_LF_LOAD(&deque->top, EMBLIB_LF_ACQUIRE);
+    if ((size_t) (b - t) > deque->mask) return false;
+
+    memcpy(ws_deque_slot(deque, b), data, deque->elem_size);
+    // publish the slot before the new bottom
+    EMBLIB_LF_STORE(&deque->bottom, b + 1, EMBLIB_LF_RELEASE);
+    return true;
+}
+
+bool emblib_ws_deque_pop(emblib_ws_deque_t *deque, void *data) {
+    if (!deque || !data) return false;
+
+    const int64_t b = EMBLIB_LF_LOAD(&deque->bottom, EMBLIB_LF_RELAXED) - 1;
+    EMBLIB_LF_STORE(&deque->bottom, b, EMBLIB_LF_RELAXED);
+    // the thieves must see the reserved slot before we read top
+    EMBLIB_LF_FENCE(EMBLIB_LF_SEQ_CST);
+    int64_t t = EMBLIB_LF_LOAD(&deque->top, EMBLIB_LF_RELAXED);
+
+    if (t > b) {
+        EMBLIB_LF_STORE(&deque->bottom, b + 1, EMBLIB_LF_RELAXED);
+        return false;
+    }
+
+    if (t < b) {
+        memcpy(data, ws_deque_slot(deque, b), deque->elem_size);
+        return true;
+    }
+
+    // last element: race the thieves for it, data is only written by the winner
+    char elem[deque->elem_size];
+    memcpy(elem, ws_deque_slot(deque, b), deque->elem_size);
+    const bool won = EMBLIB_LF_CAS(&deque->top, &t, t + 1, EMBLIB_LF_SEQ_CST, EMBLIB_LF_RELAXED);
+    EMBLIB_LF_STORE(&deque->bottom, b + 1, EMBLIB_LF_RELAXED);
+    if (won) memcpy(data, elem, deque->elem_size);
+    return won;
+}
+
+bool emblib_ws_deque_steal(emblib_ws_deque_t *deque, void *data) {
+    if (!deque || !data) return false;
+
+    int64_t t = EMBLIB_LF_LOAD(&deque->top, EMBLIB_LF_ACQUIRE);
+    EMBLIB_LF_FENCE(EMBLIB_LF_SEQ_CST);
+    const int64_t b = EMBLIB_LF_LOAD(&deque->bottom, EMBLIB_LF_ACQUIRE);
+    if (t >= b) return false;
+
+    // the slot cannot be reused before top moves past it, which makes the CAS fail
+    char elem[deque->elem_size];
+    memcpy(elem, ws_deque_slot(deque, t), deque->elem_size);
+    if (!EMBLIB_LF_CAS(&deque->top, &t, t + 1, EMBLIB_LF_SEQ_CST, EMBLIB_LF_RELAXED)) return false;
+
+    memcpy(data, elem, deque->elem_size);
+    return true;
+}
+
+size_t emblib_ws_deque_count(emblib_ws_deque_t *deque) {
+    if (!deque) return 0;
+
+    const int64_t b = EMBLIB_LF_LOAD(&deque->bottom, EMBLIB_LF_RELAXED);
+    const int64_t t = EMBLIB_LF_LOAD(&deque->top, EMBLIB_LF_RELAXED);
+    return b > t ? (size_t) (b - t) : 0;
+}
+
+size_t emblib_ws_deque_size(emblib_ws_deque_t *deque) {
+    return deque ? deque->mask + 1 : 0;
+}
+
+bool emblib_ws_deque_is_empty(emblib_ws_deque_t *deque) {
+    return emblib_ws_deque_count(deque) == 0;
+}
@@ -0,0 +1,82 @@
+#ifndef __EMB_LIB_EMBLIB_WS_DEQUE_H__
+#define __EMB_LIB_EMBLIB_WS_DEQUE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Chase-Lev work-stealing deque over a caller array. One owner thread pushes and pops
+ *        at the bottom (LIFO) with plain loads and stores, plus one fence on pop; any number of
+ *        thieves take from the top (FIFO) with one CAS. Elements are copied with memcpy, since a
+ *        thief may read a slot while racing another thief for it: they must be plain data
+ *        (a task descriptor, an index, a pointer...).
+ *        The capacity is the largest power of two of elements that fits in the array; the deque
+ *        does not grow.
+ */
+typedef struct _emblib_ws_deque_t {
+    void *array;            //!< slots
+    size_t mask;            //!< number of slots - 1
+    size_t elem_size;       //!< size of each element
+    int64_t top;            //!< next element to steal, only increases
+    char pad[64];           //!< keeps top and bottom on different cache lines
+    int64_t bottom;         //!< next free slot, written by the owner only
+} emblib_ws_deque_t;
+
+/**
+ * @brief Initializes the deque. Not thread-safe.
+ *
+ * @param[in,out] deque Pointer to the deque structure.
+ * @param[in] array Pointer to the memory where elements will be stored.
+ * @param[in] buffer_len Size in bytes of array.
+ * @param[in] size_elem Size of each element in bytes.
+ * @return true if initialization is successful, false otherwise.
+ */
+bool emblib_ws_deque_init(emblib_ws_deque_t *deque, void *array, size_t buffer_len, size_t size_elem);
+
+/**
+ * @brief Pushes an element at the bottom. Owner thread only.
+ *
+ * @param[in,out] deque Pointer to the deque structure.
+ * @param[in] data Pointer to the element to be pushed.
+ * @return true if the push is successful, false if the deque is full.
+ */
+bool emblib_ws_deque_push(emblib_ws_deque_t *deque, void *data);
+
+/**
+ * @brief Pops the element at the bottom (the last pushed). Owner thread only.
+ *
+ * @param[in,out] deque Pointer to the deque structure.
+ * @param[out] data Pointer to the memory where the popped element will be stored, untouched on failure.
+ * @return true if the pop is successful, false if the deque is empty or a thief took the last element.
+ */
+bool emblib_ws_deque_pop(emblib_ws_deque_t *deque, void *data);
+
+/**
+ * @brief Steals the element at the top (the oldest). Any thread.
+ *
+ * @param[in,out] deque Pointer to the deque structure.
+ * @param[out] data Pointer to the memory where the stolen element will be stored, untouched on failure.
+ * @return true if the steal is successful, false if the deque is empty or another thread won the element.
+ */
+bool emblib_ws_deque_steal(emblib_ws_deque_t *deque, void *data);
+
+/**
+ * @brief Returns the number of elements, only a snapshot while other threads run.
+ *
+ * @param[in] deque Pointer to the deque structure.
+ * @return Number of elements.
+ */
+size_t emblib_ws_deque_count(emblib_ws_deque_t *deque);
+
+/**
+ * @brief Returns the maximum number of elements of the deque.
+ *
+ * @param[in] deque Pointer to the deque structure.
+ * @return Maximum number of elements.
+ */
+size_t emblib_ws_deque_size(emblib_ws_deque_t *deque);
+
+bool emblib_ws_deque_is_empty(emblib_ws_deque_t *deque);
+
+#endif //__EMB_LIB_EMBLIB_WS_DEQUE_H__
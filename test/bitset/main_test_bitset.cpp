@@ -0,0 +1,99 @@
+extern "C" {
+#include "emblib_bitset.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <vector>
+
+class BitsetTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(emblib_bitset_init(&bitset, words, sizeof(words), 4096));
+    }
+
+    emblib_bitset_t bitset;
+    uint32_t words[EMBLIB_BITSET_WORDS(4096)];
+};
+
+TEST_F(BitsetTest, Initialization) {
+    EXPECT_TRUE(emblib_bitset_is_empty(&bitset));
+    EXPECT_EQ(emblib_bitset_size(&bitset), 4096);
+    EXPECT_EQ(emblib_bitset_count(&bitset), 0);
+    EXPECT_EQ(emblib_bitset_next(&bitset, 0), 4096);
+
+    emblib_bitset_t small;
+    EXPECT_FALSE(emblib_bitset_init(&small, words, 4, 33));
+    EXPECT_TRUE(emblib_bitset_init(&small, words, 8, 33));
+}
+
+TEST_F(BitsetTest, AddRemoveContains) {
+    EXPECT_TRUE(emblib_bitset_add(&bitset, 0));
+    EXPECT_TRUE(emblib_bitset_add(&bitset, 4095));
+    EXPECT_FALSE(emblib_bitset_add(&bitset, 4095));
+    EXPECT_FALSE(emblib_bitset_add(&bitset, 4096));
+    EXPECT_TRUE(emblib_bitset_contains(&bitset, 4095));
+    EXPECT_FALSE(emblib_bitset_contains(&bitset, 31));
+    EXPECT_EQ(emblib_bitset_count(&bitset), 2);
+
+    EXPECT_TRUE(emblib_bitset_remove(&bitset, 0));
+    EXPECT_FALSE(emblib_bitset_remove(&bitset, 0));
+    EXPECT_FALSE(emblib_bitset_contains(&bitset, 0));
+    EXPECT_EQ(emblib_bitset_count(&bitset), 1);
+
+    emblib_bitset_flush(&bitset);
+    EXPECT_TRUE(emblib_bitset_is_empty(&bitset));
+}
+
+TEST_F(BitsetTest, Iteration) {
+    const size_t keys[] = {3, 31, 32, 100, 1023, 1024, 4000};
+    for (size_t key : keys) {
+        emblib_bitset_add(&bitset, key);
+    }
+
+    std::vector<size_t> found;
+    for (size_t k = emblib_bitset_next(&bitset, 0); k < emblib_bitset_size(&bitset);
+         k = emblib_bitset_next(&bitset, k + 1)) {
+        found.push_back(k);
+    }
+    EXPECT_EQ(found, std::vector<size_t>(std::begin(keys), std::end(keys)));
+    EXPECT_EQ(emblib_bitset_next(&bitset, 33), 100);
+    EXPECT_EQ(emblib_bitset_next(&bitset, 4001), 4096);
+}
+
+TEST_F(BitsetTest, WordOperations) {
+    emblib_bitset_t other;
+    uint32_t other_words[EMBLIB_BITSET_WORDS(4096)];
+    emblib_bitset_init(&other, other_words, sizeof(other_words), 4096);
+
+    for (size_t k = 0; k < 4096; k += 2) emblib_bitset_add(&bitset, k);
+    for (size_t k = 0; k < 4096; k += 3) emblib_bitset_add(&other, k);
+
+    emblib_bitset_t tmp;
+    uint32_t tmp_words[EMBLIB_BITSET_WORDS(4096)];
+    emblib_bitset_init(&tmp, tmp_words, sizeof(tmp_words), 4096);
+
+    emblib_bitset_union(&tmp, &bitset);
+    EXPECT_TRUE(emblib_bitset_intersect(&tmp, &other));
+    EXPECT_EQ(emblib_bitset_count(&tmp), 683);
+    EXPECT_TRUE(emblib_bitset_contains(&tmp, 6));
+    EXPECT_FALSE(emblib_bitset_contains(&tmp, 4));
+
+    EXPECT_TRUE(emblib_bitset_union(&tmp, &other));
+    EXPECT_EQ(emblib_bitset_count(&tmp), 1366);
+
+    EXPECT_TRUE(emblib_bitset_difference(&tmp, &bitset));
+    EXPECT_EQ(emblib_bitset_count(&tmp), 683);
+    EXPECT_TRUE(emblib_bitset_contains(&tmp, 3));
+    EXPECT_FALSE(emblib_bitset_contains(&tmp, 6));
+
+    emblib_bitset_t smaller;
+    emblib_bitset_init(&smaller, tmp_words, sizeof(tmp_words), 100);
+    EXPECT_FALSE(emblib_bitset_union(&bitset, &smaller));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,72 @@
+extern "C" {
+#include "emblib_bloom.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <vector>
+
+static uint64_t u32_hash(void *data) {
+    uint64_t h = *(uint32_t *) data;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    return h ^ (h >> 33);
+}
+
+TEST(bloom_test, sizing) {
+    ASSERT_EQ(emblib_bloom_hashes_for(0.5), 1);
+    ASSERT_EQ(emblib_bloom_hashes_for(0.01), 7);
+    ASSERT_EQ(emblib_bloom_hashes_for(0.0), 0);
+    ASSERT_EQ(emblib_bloom_hashes_for(1.0), 0);
+
+    const size_t bytes = emblib_bloom_size_for(1000, 0.01);
+    ASSERT_EQ(bytes % sizeof(uint32_t), 0);
+    ASSERT_GE(bytes * 8, 9585);
+    ASSERT_LE(bytes * 8, 11000);
+    ASSERT_EQ(emblib_bloom_size_for(0, 0.01), 0);
+}
+
+TEST(bloom_test, init) {
+    emblib_bloom_t bloom;
+    uint32_t words[4];
+    ASSERT_TRUE(emblib_bloom_init(&bloom, words, sizeof(words), 3, u32_hash));
+    ASSERT_EQ(emblib_bitset_size(&bloom.bits), 128);
+    ASSERT_FALSE(emblib_bloom_init(&bloom, words, sizeof(words), 0, u32_hash));
+    ASSERT_FALSE(emblib_bloom_init(&bloom, words, sizeof(words), 3, NULL));
+}
+
+TEST(bloom_test, no_false_negatives) {
+    const double rate = 0.01;
+    std::vector<uint32_t> words(emblib_bloom_size_for(1000, rate) / sizeof(uint32_t));
+    emblib_bloom_t bloom;
+    ASSERT_TRUE(emblib_bloom_init(&bloom, words.data(), words.size() * sizeof(uint32_t),
+                                  emblib_bloom_hashes_for(rate), u32_hash));
+
+    for (uint32_t i = 0; i < 1000; i++) {
+        uint32_t v = i * 2654435761u;
+        emblib_bloom_add(&bloom, &v);
+    }
+    for (uint32_t i = 0; i < 1000; i++) {
+        uint32_t v = i * 2654435761u;
+        ASSERT_TRUE(emblib_bloom_maybe_contains(&bloom, &v));
+    }
+
+    size_t false_positives = 0;
+    for (uint32_t i = 1000; i < 101000; i++) {
+        uint32_t v = i * 2654435761u;
+        false_positives += emblib_bloom_maybe_contains(&bloom, &v);
+    }
+    ASSERT_LT(false_positives, 2000);
+
+    emblib_bloom_flush(&bloom);
+    uint32_t v = 0;
+    ASSERT_FALSE(emblib_bloom_maybe_contains(&bloom, &v));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
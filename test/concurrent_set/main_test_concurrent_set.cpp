@@ -0,0 +1,194 @@
+extern "C" {
+#include "emblib_concurrent_set.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+static void u32_copy(void *dest, void *src) {
+    if (dest && src) {
+        memcpy(dest, src, sizeof(uint32_t));
+    }
+}
+
+static int u32_cmp(void *left, void *right) {
+    return *(uint32_t *) right != *(uint32_t *) left;
+}
+
+static uint64_t u32_hash(void *data) {
+    uint64_t x = *(uint32_t *) data + 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+class ConcurrentSetTest : public ::testing::Test {
+protected:
+    emblib_concurrent_set_t set;
+    uint64_t buffer[EMBLIB_CONCURRENT_SET_STRIPES * 256];
+
+    void SetUp() override {
+        ASSERT_TRUE(emblib_concurrent_set_init(&set, buffer, sizeof(buffer), sizeof(uint32_t), u32_copy, NULL,
+                                               u32_cmp, u32_hash));
+    }
+
+    void TearDown() override {
+        emblib_concurrent_set_destroy(&set);
+    }
+};
+
+TEST_F(ConcurrentSetTest, AddContainsRemove) {
+    for (uint32_t i = 0; i < 1000; i++) {
+        ASSERT_TRUE(emblib_concurrent_set_add(&set, &i));
+    }
+    uint32_t elem = 7;
+    ASSERT_FALSE(emblib_concurrent_set_add(&set, &elem));
+    ASSERT_EQ(emblib_concurrent_set_count(&set), 1000);
+
+    for (uint32_t i = 0; i < 2000; i++) {
+        ASSERT_EQ(emblib_concurrent_set_contains(&set, &i), i < 1000);
+    }
+    for (uint32_t i = 0; i < 1000; i += 2) {
+        ASSERT_TRUE(emblib_concurrent_set_remove(&set, &i));
+    }
+    elem = 0;
+    ASSERT_FALSE(emblib_concurrent_set_contains(&set, &elem));
+    elem = 1;
+    ASSERT_TRUE(emblib_concurrent_set_contains(&set, &elem));
+    ASSERT_EQ(emblib_concurrent_set_count(&set), 500);
+
+    emblib_concurrent_set_flush(&set);
+    ASSERT_EQ(emblib_concurrent_set_count(&set), 0);
+    ASSERT_FALSE(emblib_concurrent_set_contains(&set, &elem));
+}
+
+TEST_F(ConcurrentSetTest, ReadersDuringWrites) {
+    // even keys stay in the set for the whole test, odd keys come and go
+    for (uint32_t i = 0; i < 1000; i += 2) {
+        ASSERT_TRUE(emblib_concurrent_set_add(&set, &i));
+    }
+
+    std::atomic<bool> stop(false);
+    std::atomic<int> errors(0);
+    std::vector<std::thread> threads;
+
+    for (int w = 0; w < 2; w++) {
+        threads.emplace_back([&, w]() {
+            for (int round = 0; round < 200; round++) {
+                for (uint32_t i = 1 + 2 * w; i < 1000; i += 4) {
+                    emblib_concurrent_set_add(&set, &i);
+                }
+                for (uint32_t i = 1 + 2 * w; i < 1000; i += 4) {
+                    if (!emblib_concurrent_set_remove(&set, &i)) errors++;
+                }
+            }
+        });
+    }
+    for (int r = 0; r < 4; r++) {
+        threads.emplace_back([&]() {
+            while (!stop.load()) {
+                for (uint32_t i = 0; i < 2000; i += 2) {
+                    if (emblib_concurrent_set_contains(&set, &i) != (i < 1000)) errors++;
+                }
+            }
+        });
+    }
+
+    threads[0].join();
+    threads[1].join();
+    stop.store(true);
+    for (size_t t = 2; t < threads.size(); t++) {
+        threads[t].join();
+    }
+
+    ASSERT_EQ(errors.load(), 0);
+    ASSERT_EQ(emblib_concurrent_set_count(&set), 500);
+}
+
+// element checked by its compare function: a torn copy would break the checksum
+typedef struct {
+    uint32_t key;
+    uint32_t check;
+    const uint32_t *owner;
+} checked_t;
+
+static std::atomic<int> torn_compares(0);
+static const uint32_t owners[2] = {0, 1};
+
+static void checked_copy(void *dest, void *src) {
+    memcpy(dest, src, sizeof(checked_t));
+}
+
+static bool checked_valid(const checked_t *elem) {
+    return elem->check == ~elem->key && elem->owner == &owners[elem->key & 1];
+}
+
+static int checked_cmp(void *left, void *right) {
+    if (!checked_valid((checked_t *) left) || !checked_valid((checked_t *) right)) torn_compares++;
+    return ((checked_t *) left)->key != ((checked_t *) right)->key;
+}
+
+static uint64_t checked_hash(void *data) {
+    return u32_hash(&((checked_t *) data)->key);
+}
+
+static checked_t checked_make(uint32_t key) {
+    return checked_t{key, ~key, &owners[key & 1]};
+}
+
+TEST(ConcurrentSetCallbacks, CompareSeesWholeElements) {
+    emblib_concurrent_set_t set;
+    std::vector<uint64_t> buffer(EMBLIB_CONCURRENT_SET_STRIPES * 128 * 4);
+    ASSERT_TRUE(emblib_concurrent_set_init(&set, buffer.data(), buffer.size() * sizeof(uint64_t), sizeof(checked_t),
+                                           checked_copy, NULL, checked_cmp, checked_hash));
+    for (uint32_t i = 0; i < 400; i += 2) {
+        checked_t elem = checked_make(i);
+        ASSERT_TRUE(emblib_concurrent_set_add(&set, &elem));
+    }
+
+    // removals shift whole clusters back while the readers probe them
+    std::atomic<bool> stop(false);
+    std::atomic<int> errors(0);
+    std::thread writer([&]() {
+        for (int round = 0; round < 300; round++) {
+            for (uint32_t i = 1; i < 400; i += 2) {
+                checked_t elem = checked_make(i);
+                emblib_concurrent_set_add(&set, &elem);
+            }
+            for (uint32_t i = 1; i < 400; i += 2) {
+                checked_t elem = checked_make(i);
+                emblib_concurrent_set_remove(&set, &elem);
+            }
+        }
+        stop.store(true);
+    });
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; r++) {
+        readers.emplace_back([&]() {
+            while (!stop.load()) {
+                for (uint32_t i = 0; i < 400; i += 2) {
+                    checked_t elem = checked_make(i);
+                    if (!emblib_concurrent_set_contains(&set, &elem)) errors++;
+                }
+            }
+        });
+    }
+    writer.join();
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    ASSERT_EQ(errors.load(), 0);
+    ASSERT_EQ(torn_compares.load(), 0);
+    emblib_concurrent_set_destroy(&set);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
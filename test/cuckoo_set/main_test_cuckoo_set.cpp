@@ -0,0 +1,168 @@
+extern "C" {
+#include "emblib_cuckoo_set.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <random>
+#include <set>
+#include <string.h>
+#include <vector>
+
+static int copies = 0;
+static int frees = 0;
+
+static void int_copy(void *dest, void *src) {
+    if (dest && src) {
+        memcpy(dest, src, sizeof(int));
+        copies++;
+    }
+}
+
+static void int_free(void *data) {
+    frees++;
+}
+
+static int int_cmp(void *left, void *right) {
+    return *(int *) right - *(int *) left;
+}
+
+static uint64_t int_hash(void *data) {
+    uint64_t x = (uint32_t) *(int *) data + 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// every element has the same two buckets
+static uint64_t bad_hash(void *data) {
+    return 0x0000000100000000ull;
+}
+
+TEST(CuckooSetTest, Initialization) {
+    emblib_cuckoo_set_t set;
+    std::vector<uint8_t> buffer(16 * emblib_cuckoo_set_bucket_size(sizeof(int)) + sizeof(int) +
+                                EMBLIB_CUCKOO_SET_LINE - 1);
+    ASSERT_EQ(emblib_cuckoo_set_bucket_size(sizeof(int)), EMBLIB_CUCKOO_SET_LINE);
+    ASSERT_TRUE(emblib_cuckoo_set_init(&set, buffer.data(), buffer.size(), sizeof(int), int_copy, NULL, int_cmp,
+                                       int_hash));
+    ASSERT_EQ(set.buckets, 16);
+    ASSERT_EQ(emblib_cuckoo_set_size(&set), 60);
+    ASSERT_TRUE(emblib_cuckoo_set_is_empty(&set));
+
+    ASSERT_FALSE(emblib_cuckoo_set_init(&set, buffer.data(), 64, sizeof(int), int_copy, NULL, int_cmp, int_hash));
+    ASSERT_FALSE(emblib_cuckoo_set_init(&set, buffer.data(), buffer.size(), sizeof(int), int_copy, NULL, int_cmp,
+                                        NULL));
+}
+
+TEST(CuckooSetTest, BucketsOnCacheLines) {
+    emblib_cuckoo_set_t set;
+    std::vector<uint8_t> buffer(8 * 128 + 64);
+    for (size_t offset = 0; offset < 8; offset++) {
+        ASSERT_TRUE(emblib_cuckoo_set_init(&set, buffer.data() + offset, buffer.size() - offset, 20, int_copy, NULL,
+                                           int_cmp, int_hash));
+        ASSERT_EQ((uintptr_t) set.array % EMBLIB_CUCKOO_SET_LINE, 0);
+        ASSERT_EQ(set.bucket_size, 2 * EMBLIB_CUCKOO_SET_LINE);
+        ASSERT_LE((uint8_t *) set.stash + 20, buffer.data() + buffer.size());
+    }
+    // largest element whose bucket is a single line
+    ASSERT_EQ(emblib_cuckoo_set_bucket_size(14), EMBLIB_CUCKOO_SET_LINE);
+    ASSERT_EQ(emblib_cuckoo_set_bucket_size(15), 2 * EMBLIB_CUCKOO_SET_LINE);
+}
+
+TEST(CuckooSetTest, AddContainsRemove) {
+    emblib_cuckoo_set_t set;
+    std::vector<uint8_t> buffer(8 * emblib_cuckoo_set_bucket_size(sizeof(int)) + sizeof(int) +
+                                EMBLIB_CUCKOO_SET_LINE - 1);
+    emblib_cuckoo_set_init(&set, buffer.data(), buffer.size(), sizeof(int), int_copy, NULL, int_cmp, int_hash);
+
+    int elem = 42;
+    ASSERT_TRUE(emblib_cuckoo_set_add(&set, &elem));
+    ASSERT_TRUE(emblib_cuckoo_set_contains(&set, &elem));
+    ASSERT_FALSE(emblib_cuckoo_set_add(&set, &elem));
+    ASSERT_EQ(emblib_cuckoo_set_count(&set), 1);
+
+    ASSERT_TRUE(emblib_cuckoo_set_remove(&set, &elem));
+    ASSERT_FALSE(emblib_cuckoo_set_contains(&set, &elem));
+    ASSERT_FALSE(emblib_cuckoo_set_remove(&set, &elem));
+    ASSERT_TRUE(emblib_cuckoo_set_is_empty(&set));
+}
+
+TEST(CuckooSetTest, StashAndOverflow) {
+    emblib_cuckoo_set_t set;
+    std::vector<uint8_t> buffer(4 * emblib_cuckoo_set_bucket_size(sizeof(int)) + sizeof(int) +
+                                EMBLIB_CUCKOO_SET_LINE - 1);
+    emblib_cuckoo_set_init(&set, buffer.data(), buffer.size(), sizeof(int), int_copy, int_free, int_cmp, bad_hash);
+
+    // two buckets of 4 slots, then the stash
+    for (int i = 0; i < 9; i++) {
+        ASSERT_TRUE(emblib_cuckoo_set_add(&set, &i));
+    }
+    ASSERT_TRUE(set.stash_used);
+    frees = 0;
+    int extra = 100;
+    ASSERT_FALSE(emblib_cuckoo_set_add(&set, &extra));
+    ASSERT_EQ(frees, 1);
+    for (int i = 0; i < 9; i++) {
+        ASSERT_TRUE(emblib_cuckoo_set_contains(&set, &i));
+    }
+
+    // a freed slot takes the stashed element back
+    int elem = 3;
+    ASSERT_TRUE(emblib_cuckoo_set_remove(&set, &elem));
+    ASSERT_FALSE(set.stash_used);
+    ASSERT_TRUE(emblib_cuckoo_set_add(&set, &extra));
+    ASSERT_EQ(emblib_cuckoo_set_count(&set), 9);
+
+    frees = 0;
+    emblib_cuckoo_set_flush(&set);
+    ASSERT_EQ(frees, 9);
+    ASSERT_TRUE(emblib_cuckoo_set_is_empty(&set));
+    ASSERT_FALSE(emblib_cuckoo_set_contains(&set, &extra));
+}
+
+TEST(CuckooSetTest, HighLoad) {
+    emblib_cuckoo_set_t set;
+    std::vector<uint8_t> buffer(256 * emblib_cuckoo_set_bucket_size(sizeof(int)) + sizeof(int) +
+                                EMBLIB_CUCKOO_SET_LINE - 1);
+    emblib_cuckoo_set_init(&set, buffer.data(), buffer.size(), sizeof(int), int_copy, NULL, int_cmp, int_hash);
+
+    // 4-slot buckets fill past 90% before an add fails
+    int added = 0;
+    for (int i = 0; added < (int) emblib_cuckoo_set_size(&set); i++) {
+        if (!emblib_cuckoo_set_add(&set, &i)) break;
+        added++;
+    }
+    ASSERT_GT(added, 1024 * 9 / 10);
+    for (int i = 0; i < added; i++) {
+        ASSERT_TRUE(emblib_cuckoo_set_contains(&set, &i));
+    }
+}
+
+TEST(CuckooSetTest, AgainstReference) {
+    emblib_cuckoo_set_t set;
+    std::vector<uint8_t> buffer(128 * emblib_cuckoo_set_bucket_size(sizeof(int)) + sizeof(int) +
+                                EMBLIB_CUCKOO_SET_LINE - 1);
+    emblib_cuckoo_set_init(&set, buffer.data(), buffer.size(), sizeof(int), int_copy, NULL, int_cmp, int_hash);
+
+    std::mt19937 rng(11);
+    std::set<int> reference;
+    for (int i = 0; i < 100000; i++) {
+        int elem = (int) (rng() % 1000);
+        if (reference.size() < 400 && (rng() & 1)) {
+            ASSERT_EQ(emblib_cuckoo_set_add(&set, &elem), reference.insert(elem).second);
+        } else {
+            ASSERT_EQ(emblib_cuckoo_set_remove(&set, &elem), reference.erase(elem) == 1);
+        }
+    }
+    ASSERT_EQ(emblib_cuckoo_set_count(&set), reference.size());
+    for (int elem = 0; elem < 1000; elem++) {
+        ASSERT_EQ(emblib_cuckoo_set_contains(&set, &elem), reference.count(elem) == 1);
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -5,7 +5,10 @@ extern "C" {
 }
 
 #include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
 #include <sstream>
+#include <vector>
 
 class DequeTest : public ::testing::Test {
 protected:
@@ -108,6 +111,100 @@ TEST_F(DequeTest, IsFull) {
     EXPECT_TRUE(emblib_deque_is_full(&deque));
 }
 
+TEST_F(DequeTest, At) {
+    int data;
+    EXPECT_FALSE(emblib_deque_at(&deque, 0, &data));
+    for (int i = 1; i <= 3; i++) {
+        emblib_deque_push_back(&deque, &i);
+    }
+    // head wraps around the array
+    for (int i = 10; i < 12; i++) {
+        emblib_deque_push_front(&deque, &i);
+    }
+    const int expected[] = {11, 10, 1, 2, 3};
+    for (size_t i = 0; i < 5; i++) {
+        EXPECT_TRUE(emblib_deque_at(&deque, i, &data));
+        EXPECT_EQ(data, expected[i]);
+    }
+    EXPECT_FALSE(emblib_deque_at(&deque, 5, &data));
+}
+
+TEST_F(DequeTest, BulkPushPop) {
+    int block[5] = {1, 2, 3, 4, 5};
+    int out[5] = {0};
+
+    // move head and tail away from slot 0 so that the blocks wrap
+    int data = 0;
+    for (int i = 0; i < 3; i++) {
+        emblib_deque_push_back(&deque, &data);
+        emblib_deque_pop_front(&deque, &data);
+    }
+
+    EXPECT_TRUE(emblib_deque_push_back_n(&deque, block, 3));
+    EXPECT_FALSE(emblib_deque_push_back_n(&deque, block, 3));
+    EXPECT_EQ(emblib_deque_count(&deque), 3);
+    EXPECT_TRUE(emblib_deque_push_front_n(&deque, block + 3, 2));
+    EXPECT_TRUE(emblib_deque_is_full(&deque));
+
+    const int expected[] = {4, 5, 1, 2, 3};
+    for (size_t i = 0; i < 5; i++) {
+        EXPECT_TRUE(emblib_deque_at(&deque, i, &data));
+        EXPECT_EQ(data, expected[i]);
+    }
+
+    EXPECT_FALSE(emblib_deque_pop_front_n(&deque, out, 6));
+    EXPECT_TRUE(emblib_deque_pop_back_n(&deque, out, 2));
+    EXPECT_EQ(out[0], 2);
+    EXPECT_EQ(out[1], 3);
+    EXPECT_TRUE(emblib_deque_pop_front_n(&deque, out, 3));
+    EXPECT_EQ(out[0], 4);
+    EXPECT_EQ(out[1], 5);
+    EXPECT_EQ(out[2], 1);
+    EXPECT_TRUE(emblib_deque_is_empty(&deque));
+    EXPECT_TRUE(emblib_deque_pop_back_n(&deque, out, 0));
+}
+
+static int int_max_cmp(void *left, void *right) {
+    return (*(int *) left > *(int *) right) - (*(int *) left < *(int *) right);
+}
+
+static int int_min_cmp(void *left, void *right) {
+    return int_max_cmp(right, left);
+}
+
+TEST(DequeWindowTest, MaxAndMin) {
+    const size_t window = 16;
+    emblib_deque_window_t max_win, min_win;
+    size_t max_buffer[window * 2], min_buffer[window * 2];
+    ASSERT_TRUE(emblib_deque_window_init(&max_win, max_buffer, sizeof(max_buffer), window, sizeof(int), int_max_cmp));
+    ASSERT_TRUE(emblib_deque_window_init(&min_win, min_buffer, sizeof(min_buffer), window, sizeof(int), int_min_cmp));
+    ASSERT_FALSE(emblib_deque_window_init(&max_win, max_buffer, window, window, sizeof(int), int_max_cmp));
+
+    int value;
+    ASSERT_FALSE(emblib_deque_window_get(&max_win, &value));
+
+    std::mt19937 rng(3);
+    std::vector<int> samples;
+    for (int i = 0; i < 5000; i++) {
+        // runs of rising and falling samples, with repeats
+        int sample = (int) (rng() % 100) - 50;
+        samples.push_back(sample);
+        ASSERT_TRUE(emblib_deque_window_push(&max_win, &sample));
+        ASSERT_TRUE(emblib_deque_window_push(&min_win, &sample));
+
+        const size_t first = samples.size() > window ? samples.size() - window : 0;
+        ASSERT_EQ(emblib_deque_window_count(&max_win), samples.size() - first);
+        ASSERT_TRUE(emblib_deque_window_get(&max_win, &value));
+        ASSERT_EQ(value, *std::max_element(samples.begin() + first, samples.end()));
+        ASSERT_TRUE(emblib_deque_window_get(&min_win, &value));
+        ASSERT_EQ(value, *std::min_element(samples.begin() + first, samples.end()));
+    }
+
+    emblib_deque_window_flush(&max_win);
+    ASSERT_EQ(emblib_deque_window_count(&max_win), 0);
+    ASSERT_FALSE(emblib_deque_window_get(&max_win, &value));
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,98 @@
+extern "C" {
+#include "emblib_dheap.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+// earliest deadline first
+static int deadline_cmp(void *left, void *right) {
+    const uint64_t l = *(uint64_t *) left, r = *(uint64_t *) right;
+    return (l < r) - (l > r);
+}
+
+TEST(dheap_test, init) {
+    emblib_dheap_t heap;
+    alignas(64) uint64_t array[64];
+    ASSERT_TRUE(emblib_dheap_init(&heap, array, sizeof(array), 8, sizeof(uint64_t), 0, deadline_cmp));
+    ASSERT_EQ(emblib_dheap_size(&heap), 57);
+    ASSERT_EQ(heap.payloads, nullptr);
+
+    // the children of the root (elements 1..8) fill the second cache line
+    uint64_t key = 100;
+    for (int i = 0; i < 9; i++, key++) {
+        emblib_dheap_push(&heap, &key, NULL);
+    }
+    ASSERT_EQ(array[7], 100);
+    for (int i = 8; i < 16; i++) {
+        ASSERT_GT(array[i], 100);
+    }
+
+    ASSERT_FALSE(emblib_dheap_init(&heap, array, sizeof(array), 3, sizeof(uint64_t), 0, deadline_cmp));
+    ASSERT_FALSE(emblib_dheap_init(&heap, array, 7 * sizeof(uint64_t), 8, sizeof(uint64_t), 0, deadline_cmp));
+    ASSERT_FALSE(emblib_dheap_init(&heap, array, sizeof(array), 4, sizeof(uint64_t), 0, NULL));
+}
+
+TEST(dheap_test, payloads) {
+    emblib_dheap_t heap;
+    alignas(64) uint8_t array[4 * 8 + 8 * (8 + 4)];
+    ASSERT_TRUE(emblib_dheap_init(&heap, array, sizeof(array), 4, sizeof(uint64_t), sizeof(uint32_t),
+                                  deadline_cmp));
+    ASSERT_EQ(emblib_dheap_size(&heap), 8);
+
+    for (uint32_t id = 0; id < 8; id++) {
+        uint64_t deadline = (id * 5) % 8;
+        ASSERT_TRUE(emblib_dheap_push(&heap, &deadline, &id));
+    }
+    uint64_t deadline = 0;
+    uint32_t id = 0;
+    ASSERT_FALSE(emblib_dheap_push(&heap, &deadline, &id));
+    ASSERT_FALSE(emblib_dheap_push(&heap, &deadline, NULL));
+
+    for (uint64_t expected = 0; expected < 8; expected++) {
+        ASSERT_TRUE(emblib_dheap_pop(&heap, &deadline, &id));
+        ASSERT_EQ(deadline, expected);
+        ASSERT_EQ((id * 5) % 8, expected);
+    }
+    ASSERT_FALSE(emblib_dheap_pop(&heap, &deadline, &id));
+}
+
+TEST(dheap_test, against_reference) {
+    for (size_t arity : {2, 4, 8}) {
+        emblib_dheap_t heap;
+        std::vector<uint64_t> array(4096);
+        ASSERT_TRUE(emblib_dheap_init(&heap, array.data(), array.size() * sizeof(uint64_t), arity,
+                                      sizeof(uint64_t), sizeof(uint64_t), deadline_cmp));
+
+        std::mt19937 rng((unsigned) arity);
+        std::priority_queue<std::pair<uint64_t, uint64_t>, std::vector<std::pair<uint64_t, uint64_t>>,
+                std::greater<>> reference;
+        for (uint64_t i = 0; i < 20000; i++) {
+            if (reference.size() < emblib_dheap_size(&heap) && rng() % 3) {
+                // unique payloads to check that they travel with their key
+                uint64_t key = rng() % 1000, payload = key << 32 | i;
+                ASSERT_TRUE(emblib_dheap_push(&heap, &key, &payload));
+                reference.push({key, payload});
+            } else if (!reference.empty()) {
+                uint64_t key, payload;
+                ASSERT_TRUE(emblib_dheap_pop(&heap, &key, &payload));
+                ASSERT_EQ(key, reference.top().first);
+                ASSERT_EQ(payload >> 32, key);
+                reference.pop();
+            }
+        }
+        ASSERT_EQ(emblib_dheap_count(&heap), reference.size());
+        emblib_dheap_flush(&heap);
+        ASSERT_TRUE(emblib_dheap_is_empty(&heap));
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
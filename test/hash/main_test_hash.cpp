@@ -0,0 +1,103 @@
+extern "C" {
+#include "emblib_hash.h"
+#include "emblib_hash_set.h"
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <set>
+#include <string.h>
+#include <vector>
+
+TEST(hash_test, deterministic_and_seeded) {
+    const char *text = "emblib hash";
+    ASSERT_EQ(emblib_hash64(text, strlen(text), 0), emblib_hash64(text, strlen(text), 0));
+    ASSERT_NE(emblib_hash64(text, strlen(text), 0), emblib_hash64(text, strlen(text), 1));
+    ASSERT_NE(emblib_hash64(text, 0, 0), emblib_hash64(text, 0, 1));
+}
+
+TEST(hash_test, fixed_size_paths_match) {
+    uint8_t bytes[17];
+    for (int i = 0; i < 17; i++) bytes[i] = (uint8_t) (i * 37 + 11);
+
+    for (uint64_t seed = 0; seed < 4; seed++) {
+        // unaligned on purpose
+        ASSERT_EQ(emblib_hash32_key(bytes + 1, seed), emblib_hash64(bytes + 1, 4, seed));
+        ASSERT_EQ(emblib_hash64_key(bytes + 1, seed), emblib_hash64(bytes + 1, 8, seed));
+        ASSERT_EQ(emblib_hash128_key(bytes + 1, seed), emblib_hash64(bytes + 1, 16, seed));
+    }
+    uint32_t key32 = 42;
+    ASSERT_EQ(emblib_hash_fn_32(&key32), emblib_hash64(&key32, sizeof(key32), 0));
+}
+
+TEST(hash_test, lengths_and_prefixes_differ) {
+    // every prefix of a 300-byte buffer, crossing the 3, 16 and 48-byte paths
+    std::vector<uint8_t> bytes(300, 0);
+    std::set<uint64_t> hashes;
+    for (size_t len = 0; len <= bytes.size(); len++) {
+        hashes.insert(emblib_hash64(bytes.data(), len, 0));
+    }
+    ASSERT_EQ(hashes.size(), bytes.size() + 1);
+}
+
+TEST(hash_test, avalanche) {
+    // flipping any input bit flips about half of the output bits
+    for (size_t len : {4, 8, 13, 16, 40, 100}) {
+        uint8_t bytes[100] = {0};
+        const uint64_t base = emblib_hash64(bytes, len, 0);
+        double flipped = 0;
+        for (size_t bit = 0; bit < len * 8; bit++) {
+            bytes[bit / 8] ^= (uint8_t) (1u << (bit % 8));
+            flipped += emblib_popcount32((uint32_t) (base ^ emblib_hash64(bytes, len, 0))) +
+                       emblib_popcount32((uint32_t) ((base ^ emblib_hash64(bytes, len, 0)) >> 32));
+            bytes[bit / 8] ^= (uint8_t) (1u << (bit % 8));
+        }
+        flipped /= (double) (len * 8);
+        ASSERT_GT(flipped, 28.0) << len;
+        ASSERT_LT(flipped, 36.0) << len;
+    }
+}
+
+TEST(hash_test, hash_many) {
+    uint64_t keys[64];
+    uint64_t out[64];
+    for (int i = 0; i < 64; i++) keys[i] = (uint64_t) i * 1000003u;
+
+    for (size_t elem_size : {4, 8, 16, 12}) {
+        const size_t count = sizeof(keys) / elem_size;
+        std::vector<uint64_t> many(count);
+        emblib_hash_many(keys, count, elem_size, 7, many.data());
+        for (size_t i = 0; i < count; i++) {
+            ASSERT_EQ(many[i], emblib_hash64((uint8_t *) keys + i * elem_size, elem_size, 7));
+        }
+    }
+    emblib_hash_many(keys, 64, 8, 0, out);
+    ASSERT_EQ(out[5], emblib_hash_fn_64(&keys[5]));
+}
+
+static void u64_copy(void *dest, void *src) {
+    memcpy(dest, src, sizeof(uint64_t));
+}
+
+static int u64_cmp(void *left, void *right) {
+    return *(uint64_t *) left != *(uint64_t *) right;
+}
+
+TEST(hash_test, container_callback) {
+    emblib_hash_set_t set;
+    uint8_t buffer[1024 * (sizeof(uint64_t) + 1)];
+    ASSERT_TRUE(emblib_hash_set_init(&set, buffer, sizeof(buffer), sizeof(uint64_t), u64_copy, NULL, u64_cmp,
+                                     emblib_hash_fn_64));
+    // sequential keys with a stride that defeats the identity hash
+    for (uint64_t i = 0; i < emblib_hash_set_size(&set); i++) {
+        uint64_t key = i << 20;
+        ASSERT_TRUE(emblib_hash_set_add(&set, &key));
+    }
+    uint64_t key = 5ull << 20;
+    ASSERT_TRUE(emblib_hash_set_contains(&set, &key));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
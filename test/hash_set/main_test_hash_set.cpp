@@ -0,0 +1,118 @@
+extern "C" {
+#include "emblib_hash_set.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <string.h>
+#include <vector>
+
+static void int_copy(void *dest, void *src) {
+    if (dest && src) {
+        memcpy(dest, src, sizeof(int));
+    }
+}
+
+static int int_cmp(void *left, void *right) {
+    return *(int *) right - *(int *) left;
+}
+
+static uint64_t int_hash(void *data) {
+    return (uint64_t) (uint32_t) *(int *) data * 0x9E3779B97F4A7C15ull >> 17;
+}
+
+// every element collides: exercises long clusters
+static uint64_t bad_hash(void *data) {
+    return 3;
+}
+
+TEST(HashSetTest, Initialization) {
+    emblib_hash_set_t set;
+    uint8_t buffer[16 * (sizeof(int) + 1)];
+    ASSERT_TRUE(emblib_hash_set_init(&set, buffer, sizeof(buffer), sizeof(int), int_copy, NULL, int_cmp, int_hash));
+    ASSERT_TRUE(emblib_hash_set_is_empty(&set));
+    ASSERT_FALSE(emblib_hash_set_is_full(&set));
+    ASSERT_EQ(set.capacity, 16);
+    ASSERT_EQ(emblib_hash_set_size(&set), 14);
+    ASSERT_EQ(emblib_hash_set_count(&set), 0);
+
+    ASSERT_FALSE(emblib_hash_set_init(&set, buffer, sizeof(buffer), sizeof(int), int_copy, NULL, int_cmp, NULL));
+    ASSERT_FALSE(emblib_hash_set_init(&set, buffer, sizeof(int), sizeof(int), int_copy, NULL, int_cmp, int_hash));
+}
+
+TEST(HashSetTest, AddContainsRemove) {
+    emblib_hash_set_t set;
+    uint8_t buffer[64 * (sizeof(int) + 1)];
+    emblib_hash_set_init(&set, buffer, sizeof(buffer), sizeof(int), int_copy, NULL, int_cmp, int_hash);
+
+    int elem = 42;
+    ASSERT_TRUE(emblib_hash_set_add(&set, &elem));
+    ASSERT_TRUE(emblib_hash_set_contains(&set, &elem));
+    ASSERT_FALSE(emblib_hash_set_add(&set, &elem));
+    ASSERT_EQ(emblib_hash_set_count(&set), 1);
+
+    ASSERT_TRUE(emblib_hash_set_remove(&set, &elem));
+    ASSERT_FALSE(emblib_hash_set_contains(&set, &elem));
+    ASSERT_FALSE(emblib_hash_set_remove(&set, &elem));
+    ASSERT_TRUE(emblib_hash_set_is_empty(&set));
+}
+
+TEST(HashSetTest, FillUntilFull) {
+    emblib_hash_set_t set;
+    uint8_t buffer[32 * (sizeof(int) + 1)];
+    emblib_hash_set_init(&set, buffer, sizeof(buffer), sizeof(int), int_copy, NULL, int_cmp, int_hash);
+
+    int i = 0;
+    for (; i < (int) emblib_hash_set_size(&set); i++) {
+        ASSERT_TRUE(emblib_hash_set_add(&set, &i));
+    }
+    ASSERT_TRUE(emblib_hash_set_is_full(&set));
+    ASSERT_FALSE(emblib_hash_set_add(&set, &i));
+
+    emblib_hash_set_flush(&set);
+    ASSERT_TRUE(emblib_hash_set_is_empty(&set));
+    i = 0;
+    ASSERT_FALSE(emblib_hash_set_contains(&set, &i));
+}
+
+TEST(HashSetTest, CollidingElements) {
+    emblib_hash_set_t set;
+    uint8_t buffer[32 * (sizeof(int) + 1)];
+    emblib_hash_set_init(&set, buffer, sizeof(buffer), sizeof(int), int_copy, NULL, int_cmp, bad_hash);
+
+    for (int i = 0; i < 20; i++) {
+        ASSERT_TRUE(emblib_hash_set_add(&set, &i));
+    }
+    for (int i = 0; i < 20; i += 3) {
+        ASSERT_TRUE(emblib_hash_set_remove(&set, &i));
+    }
+    for (int i = 0; i < 20; i++) {
+        ASSERT_EQ(emblib_hash_set_contains(&set, &i), i % 3 != 0) << i;
+    }
+}
+
+TEST(HashSetTest, ManyElements) {
+    emblib_hash_set_t set;
+    std::vector<uint8_t> buffer(16384 * (sizeof(int) + 1));
+    emblib_hash_set_init(&set, buffer.data(), buffer.size(), sizeof(int), int_copy, NULL, int_cmp, int_hash);
+
+    for (int i = 0; i < 10000; i++) {
+        int v = i * 7;
+        ASSERT_TRUE(emblib_hash_set_add(&set, &v));
+    }
+    for (int i = 0; i < 10000; i += 2) {
+        int v = i * 7;
+        ASSERT_TRUE(emblib_hash_set_remove(&set, &v));
+    }
+    ASSERT_EQ(emblib_hash_set_count(&set), 5000);
+    for (int i = 0; i < 70000; i++) {
+        bool expected = (i % 7 == 0) && ((i / 7) % 2 == 1) && (i / 7 < 10000);
+        ASSERT_EQ(emblib_hash_set_contains(&set, &i), expected) << i;
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,143 @@
+extern "C" {
+#include "emblib_ilist.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <stddef.h>
+#include <vector>
+
+typedef struct _item_t {
+    int value;
+    emblib_ilist_node_t node;
+} item_t;
+
+class IListTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(emblib_ilist_pool_init(&pool, items, sizeof(items), sizeof(items[0]), offsetof(item_t, node)));
+        ASSERT_TRUE(emblib_ilist_init(&list, &pool));
+    }
+
+    emblib_ilist_index_t make(int value) {
+        emblib_ilist_index_t h = emblib_ilist_pool_alloc(&pool);
+        ((item_t *) emblib_ilist_pool_elem(&pool, h))->value = value;
+        return h;
+    }
+
+    std::vector<int> values(emblib_ilist_t *l) {
+        std::vector<int> v;
+        for (emblib_ilist_index_t h = emblib_ilist_front(l); h != EMBLIB_ILIST_NIL; h = emblib_ilist_next(l, h)) {
+            v.push_back(((item_t *) emblib_ilist_pool_elem(&pool, h))->value);
+        }
+        return v;
+    }
+
+    emblib_ilist_pool_t pool;
+    emblib_ilist_t list;
+    item_t items[8];
+};
+
+TEST_F(IListTest, Initialization) {
+    EXPECT_TRUE(emblib_ilist_is_empty(&list));
+    EXPECT_EQ(emblib_ilist_count(&list), 0);
+    EXPECT_EQ(emblib_ilist_pool_available(&pool), ARRAY_LEN(items));
+    EXPECT_EQ(emblib_ilist_front(&list), EMBLIB_ILIST_NIL);
+    EXPECT_EQ(emblib_ilist_back(&list), EMBLIB_ILIST_NIL);
+}
+
+TEST_F(IListTest, InitInvalidNodeOffset) {
+    emblib_ilist_pool_t p;
+    EXPECT_FALSE(emblib_ilist_pool_init(&p, items, sizeof(items), sizeof(items[0]), sizeof(item_t)));
+    EXPECT_FALSE(emblib_ilist_pool_init(&p, items, sizeof(items) - 1, sizeof(items[0]), 0));
+}
+
+TEST_F(IListTest, PoolExhaustion) {
+    for (size_t i = 0; i < ARRAY_LEN(items); i++) {
+        EXPECT_NE(emblib_ilist_pool_alloc(&pool), EMBLIB_ILIST_NIL);
+    }
+    EXPECT_EQ(emblib_ilist_pool_alloc(&pool), EMBLIB_ILIST_NIL);
+    emblib_ilist_pool_free(&pool, 3);
+    EXPECT_EQ(emblib_ilist_pool_alloc(&pool), 3);
+}
+
+TEST_F(IListTest, PushFrontBack) {
+    emblib_ilist_push_back(&list, make(2));
+    emblib_ilist_push_back(&list, make(3));
+    emblib_ilist_push_front(&list, make(1));
+    EXPECT_EQ(values(&list), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(emblib_ilist_count(&list), 3);
+}
+
+TEST_F(IListTest, InsertBeforeAfter) {
+    emblib_ilist_index_t a = make(1);
+    emblib_ilist_index_t c = make(3);
+    emblib_ilist_push_back(&list, a);
+    emblib_ilist_push_back(&list, c);
+    EXPECT_TRUE(emblib_ilist_insert_before(&list, c, make(2)));
+    EXPECT_TRUE(emblib_ilist_insert_after(&list, c, make(4)));
+    EXPECT_TRUE(emblib_ilist_insert_after(&list, EMBLIB_ILIST_NIL, make(0)));
+    EXPECT_EQ(values(&list), (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(IListTest, RemoveKeepsAddresses) {
+    emblib_ilist_index_t h[4];
+    for (int i = 0; i < 4; i++) {
+        h[i] = make(i);
+        emblib_ilist_push_back(&list, h[i]);
+    }
+    item_t *third = (item_t *) emblib_ilist_pool_elem(&pool, h[3]);
+
+    EXPECT_TRUE(emblib_ilist_remove(&list, h[1]));
+    EXPECT_TRUE(emblib_ilist_remove(&list, h[0]));
+    EXPECT_EQ(values(&list), (std::vector<int>{2, 3}));
+    EXPECT_EQ(emblib_ilist_pool_elem(&pool, h[3]), third);
+    EXPECT_EQ(emblib_ilist_pool_handle(&pool, third), h[3]);
+    EXPECT_EQ(emblib_ilist_front(&list), h[2]);
+    EXPECT_EQ(emblib_ilist_prev(&list, h[3]), h[2]);
+
+    EXPECT_TRUE(emblib_ilist_remove(&list, h[3]));
+    EXPECT_TRUE(emblib_ilist_remove(&list, h[2]));
+    EXPECT_TRUE(emblib_ilist_is_empty(&list));
+    EXPECT_EQ(emblib_ilist_back(&list), EMBLIB_ILIST_NIL);
+}
+
+TEST_F(IListTest, Splice) {
+    emblib_ilist_t other;
+    emblib_ilist_init(&other, &pool);
+
+    emblib_ilist_index_t last = make(4);
+    emblib_ilist_push_back(&list, make(1));
+    emblib_ilist_push_back(&list, last);
+    emblib_ilist_push_back(&other, make(2));
+    emblib_ilist_push_back(&other, make(3));
+
+    EXPECT_TRUE(emblib_ilist_splice(&list, last, &other));
+    EXPECT_EQ(values(&list), (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_TRUE(emblib_ilist_is_empty(&other));
+
+    emblib_ilist_push_back(&other, make(5));
+    EXPECT_TRUE(emblib_ilist_splice(&list, EMBLIB_ILIST_NIL, &other));
+    EXPECT_EQ(values(&list), (std::vector<int>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(emblib_ilist_count(&list), 5);
+}
+
+TEST_F(IListTest, FlushReturnsNodesToPool) {
+    for (int i = 0; i < 5; i++) {
+        emblib_ilist_push_back(&list, make(i));
+    }
+    EXPECT_EQ(emblib_ilist_pool_available(&pool), ARRAY_LEN(items) - 5);
+    emblib_ilist_flush(&list);
+    EXPECT_TRUE(emblib_ilist_is_empty(&list));
+    EXPECT_EQ(emblib_ilist_pool_available(&pool), ARRAY_LEN(items));
+
+    for (size_t i = 0; i < ARRAY_LEN(items); i++) {
+        EXPECT_NE(emblib_ilist_pool_alloc(&pool), EMBLIB_ILIST_NIL);
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
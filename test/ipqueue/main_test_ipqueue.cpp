@@ -0,0 +1,135 @@
+extern "C" {
+#include "emblib_ipqueue.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <map>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+// higher priority value first
+static int prio_cmp(void *left, void *right) {
+    return (*(int *) left > *(int *) right) - (*(int *) left < *(int *) right);
+}
+
+TEST(ipqueue_test, init) {
+    emblib_ipqueue_t pqueue;
+    uint32_t array[30];
+    ASSERT_TRUE(emblib_ipqueue_init(&pqueue, array, sizeof(array), sizeof(int), prio_cmp));
+    ASSERT_EQ(emblib_ipqueue_size(&pqueue), 10);
+    ASSERT_TRUE(emblib_ipqueue_is_empty(&pqueue));
+
+    // keys of 2 bytes: heap and positions realigned
+    ASSERT_TRUE(emblib_ipqueue_init(&pqueue, array, sizeof(array), 2, prio_cmp));
+    ASSERT_EQ((uintptr_t) pqueue.heap % sizeof(uint32_t), 0);
+    ASSERT_LE((char *) (pqueue.pos + pqueue.capacity), (char *) array + sizeof(array));
+
+    ASSERT_FALSE(emblib_ipqueue_init(&pqueue, array, 4, sizeof(int), prio_cmp));
+    ASSERT_FALSE(emblib_ipqueue_init(&pqueue, array, sizeof(array), sizeof(int), NULL));
+}
+
+TEST(ipqueue_test, change_key_and_remove) {
+    emblib_ipqueue_t pqueue;
+    uint32_t array[8 * 3];
+    emblib_ipqueue_init(&pqueue, array, sizeof(array), sizeof(int), prio_cmp);
+
+    const int prio[] = {5, 3, 8, 1, 7};
+    for (uint32_t task = 0; task < 5; task++) {
+        ASSERT_TRUE(emblib_ipqueue_push(&pqueue, task, (void *) &prio[task]));
+    }
+    int key = 0;
+    ASSERT_FALSE(emblib_ipqueue_push(&pqueue, 2, &key));
+    ASSERT_FALSE(emblib_ipqueue_push(&pqueue, 8, &key));
+
+    uint32_t task;
+    ASSERT_TRUE(emblib_ipqueue_peek(&pqueue, &task, &key));
+    ASSERT_EQ(task, 2);
+
+    // task 3 jumps to the front, task 2 drops behind task 4
+    key = 10;
+    ASSERT_TRUE(emblib_ipqueue_change_key(&pqueue, 3, &key));
+    key = 6;
+    ASSERT_TRUE(emblib_ipqueue_change_key(&pqueue, 2, &key));
+    ASSERT_TRUE(emblib_ipqueue_remove(&pqueue, 0));
+    ASSERT_FALSE(emblib_ipqueue_remove(&pqueue, 0));
+    ASSERT_FALSE(emblib_ipqueue_contains(&pqueue, 0));
+    ASSERT_FALSE(emblib_ipqueue_change_key(&pqueue, 0, &key));
+    ASSERT_TRUE(emblib_ipqueue_get_key(&pqueue, 2, &key));
+    ASSERT_EQ(key, 6);
+
+    const std::pair<uint32_t, int> expected[] = {{3, 10}, {4, 7}, {2, 6}, {1, 3}};
+    for (auto e : expected) {
+        ASSERT_TRUE(emblib_ipqueue_pop(&pqueue, &task, &key));
+        ASSERT_EQ(task, e.first);
+        ASSERT_EQ(key, e.second);
+    }
+    ASSERT_FALSE(emblib_ipqueue_pop(&pqueue, &task, &key));
+
+    // a popped handle can be queued again
+    ASSERT_TRUE(emblib_ipqueue_push(&pqueue, 3, &key));
+    emblib_ipqueue_flush(&pqueue);
+    ASSERT_FALSE(emblib_ipqueue_contains(&pqueue, 3));
+    ASSERT_TRUE(emblib_ipqueue_push(&pqueue, 3, &key));
+}
+
+TEST(ipqueue_test, against_reference) {
+    const uint32_t handles = 300;
+    emblib_ipqueue_t pqueue;
+    std::vector<uint32_t> array(handles * 3);
+    ASSERT_TRUE(emblib_ipqueue_init(&pqueue, array.data(), array.size() * sizeof(uint32_t), sizeof(int), prio_cmp));
+    ASSERT_EQ(emblib_ipqueue_size(&pqueue), handles);
+
+    std::mt19937 rng(4);
+    std::map<uint32_t, int> keys;
+    std::set<std::pair<int, uint32_t>> order;
+    for (int i = 0; i < 50000; i++) {
+        const uint32_t handle = rng() % handles;
+        int key = (int) (rng() % 1000);
+        switch (rng() % 4) {
+            case 0:
+                ASSERT_EQ(emblib_ipqueue_push(&pqueue, handle, &key), !keys.count(handle));
+                if (!keys.count(handle)) {
+                    keys[handle] = key;
+                    order.insert({key, handle});
+                }
+                break;
+            case 1:
+                ASSERT_EQ(emblib_ipqueue_change_key(&pqueue, handle, &key), keys.count(handle) == 1);
+                if (keys.count(handle)) {
+                    order.erase({keys[handle], handle});
+                    keys[handle] = key;
+                    order.insert({key, handle});
+                }
+                break;
+            case 2:
+                ASSERT_EQ(emblib_ipqueue_remove(&pqueue, handle), keys.count(handle) == 1);
+                if (keys.count(handle)) {
+                    order.erase({keys[handle], handle});
+                    keys.erase(handle);
+                }
+                break;
+            default: {
+                uint32_t popped;
+                int popped_key;
+                ASSERT_EQ(emblib_ipqueue_pop(&pqueue, &popped, &popped_key), !keys.empty());
+                if (!keys.empty()) {
+                    // ties may come out in any order: compare the key only
+                    ASSERT_EQ(popped_key, order.rbegin()->first);
+                    order.erase({popped_key, popped});
+                    keys.erase(popped);
+                }
+                break;
+            }
+        }
+        ASSERT_EQ(emblib_ipqueue_count(&pqueue), keys.size());
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
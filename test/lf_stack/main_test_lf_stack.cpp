@@ -0,0 +1,106 @@
+extern "C" {
+#include "emblib_lf_stack.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+typedef struct _buffer_t {
+    int owner;
+    uint8_t data[60];
+} buffer_t;
+
+TEST(LfStackTest, Initialization) {
+    emblib_lf_stack_t stack;
+    uint32_t array[16];
+    ASSERT_TRUE(emblib_lf_stack_init(&stack, array, sizeof(array), 12, false));
+    ASSERT_EQ(emblib_lf_stack_size(&stack), 4);
+    ASSERT_TRUE(emblib_lf_stack_is_empty(&stack));
+    ASSERT_EQ(emblib_lf_stack_pop(&stack), nullptr);
+
+    // node size not a multiple of 4: the next indices are realigned
+    ASSERT_TRUE(emblib_lf_stack_init(&stack, array, sizeof(array), 3, true));
+    ASSERT_EQ(emblib_lf_stack_size(&stack), 9);
+    ASSERT_EQ((uintptr_t) stack.next % sizeof(uint32_t), 0);
+    ASSERT_FALSE(emblib_lf_stack_is_empty(&stack));
+
+    ASSERT_FALSE(emblib_lf_stack_init(&stack, array, 4, 12, true));
+    ASSERT_FALSE(emblib_lf_stack_init(&stack, NULL, sizeof(array), 12, true));
+}
+
+TEST(LfStackTest, LifoOrder) {
+    emblib_lf_stack_t stack;
+    uint32_t array[32];
+    emblib_lf_stack_init(&stack, array, sizeof(array), sizeof(uint32_t) * 3, true);
+
+    // a full stack pops the nodes in pool order
+    std::vector<void *> nodes;
+    while (void *node = emblib_lf_stack_pop(&stack)) {
+        nodes.push_back(node);
+    }
+    ASSERT_EQ(nodes.size(), emblib_lf_stack_size(&stack));
+    for (size_t i = 0; i < nodes.size(); i++) {
+        ASSERT_EQ(nodes[i], (char *) array + i * 12);
+    }
+
+    ASSERT_TRUE(emblib_lf_stack_push(&stack, nodes[2]));
+    ASSERT_TRUE(emblib_lf_stack_push(&stack, nodes[0]));
+    ASSERT_FALSE(emblib_lf_stack_push(&stack, (char *) nodes[1] + 1));
+    ASSERT_FALSE(emblib_lf_stack_push(&stack, (char *) array + 12 * nodes.size()));
+    ASSERT_EQ(emblib_lf_stack_pop(&stack), nodes[0]);
+    ASSERT_EQ(emblib_lf_stack_pop(&stack), nodes[2]);
+    ASSERT_TRUE(emblib_lf_stack_is_empty(&stack));
+}
+
+TEST(LfStackTest, ConcurrentFreeList) {
+    // a popped buffer is never handed to two threads at once
+    emblib_lf_stack_t stack;
+    std::vector<uint32_t> array(32 * (sizeof(buffer_t) + sizeof(uint32_t)) / sizeof(uint32_t));
+    ASSERT_TRUE(emblib_lf_stack_init(&stack, array.data(), array.size() * sizeof(uint32_t), sizeof(buffer_t), true));
+    ASSERT_EQ(emblib_lf_stack_size(&stack), 32);
+    for (size_t i = 0; i < 32; i++) {
+        ((buffer_t *) array.data())[i].owner = -1;
+    }
+
+    std::atomic<int> errors(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 6; t++) {
+        threads.emplace_back([&, t]() {
+            buffer_t *held[3];
+            for (int round = 0; round < 50000; round++) {
+                int n = 0;
+                while (n < 3 && (held[n] = (buffer_t *) emblib_lf_stack_pop(&stack))) {
+                    int expected = -1;
+                    if (!__atomic_compare_exchange_n(&held[n]->owner, &expected, t, false, __ATOMIC_ACQ_REL,
+                                                     __ATOMIC_RELAXED)) {
+                        errors++;
+                    }
+                    n++;
+                }
+                while (n--) {
+                    __atomic_store_n(&held[n]->owner, -1, __ATOMIC_RELEASE);
+                    if (!emblib_lf_stack_push(&stack, held[n])) errors++;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(errors.load(), 0);
+    size_t count = 0;
+    while (emblib_lf_stack_pop(&stack)) {
+        count++;
+    }
+    ASSERT_EQ(count, 32);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
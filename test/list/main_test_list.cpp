@@ -121,6 +121,134 @@ TEST_F(ListTest, GetAtInvalidIndex) {
     EXPECT_FALSE(emblib_list_get(&list, 0, &value)); // Índice inválido, pois a lista está vazia
 }
 
+TEST_F(ListTest, InsertRange) {
+    int head[] = {1, 5};
+    int block[] = {2, 3, 4};
+    EXPECT_TRUE(emblib_list_insert_range(&list, 0, head, ARRAY_LEN(head)));
+    EXPECT_TRUE(emblib_list_insert_range(&list, 1, block, ARRAY_LEN(block)));
+    EXPECT_EQ(emblib_list_count(&list), 5);
+
+    int values[5];
+    EXPECT_TRUE(emblib_list_get_range(&list, 0, values, ARRAY_LEN(values)));
+    int expected[] = {1, 2, 3, 4, 5};
+    EXPECT_EQ(memcmp(values, expected, sizeof(expected)), 0);
+}
+
+TEST_F(ListTest, InsertRangeOverflow) {
+    int block[11] = {0};
+    EXPECT_FALSE(emblib_list_insert_range(&list, 0, block, ARRAY_LEN(block)));
+    EXPECT_TRUE(emblib_list_is_empty(&list));
+    EXPECT_FALSE(emblib_list_insert_range(&list, 1, block, 1));
+}
+
+TEST_F(ListTest, RemoveRange) {
+    int elements[] = {1, 2, 3, 4, 5, 6};
+    emblib_list_insert_range(&list, 0, elements, ARRAY_LEN(elements));
+
+    int removed[3];
+    EXPECT_TRUE(emblib_list_remove_range(&list, 1, removed, ARRAY_LEN(removed)));
+    EXPECT_EQ(removed[0], 2);
+    EXPECT_EQ(removed[2], 4);
+    EXPECT_EQ(emblib_list_count(&list), 3);
+
+    int values[3];
+    EXPECT_TRUE(emblib_list_get_range(&list, 0, values, ARRAY_LEN(values)));
+    int expected[] = {1, 5, 6};
+    EXPECT_EQ(memcmp(values, expected, sizeof(expected)), 0);
+
+    EXPECT_FALSE(emblib_list_remove_range(&list, 1, NULL, 3));
+    EXPECT_TRUE(emblib_list_remove_range(&list, 1, NULL, 2));
+    EXPECT_EQ(emblib_list_count(&list), 1);
+}
+
+TEST_F(ListTest, RangeOnWrappedStorage) {
+    // move the head to the end of the array so the elements wrap around
+    int dummy = 0;
+    for (int i = 0; i < 8; ++i) {
+        emblib_circ_buffer_insert(&list, &dummy);
+        emblib_circ_buffer_retrieve(&list, &dummy);
+    }
+
+    int elements[] = {1, 2, 7, 8};
+    int block[] = {3, 4, 5, 6};
+    EXPECT_TRUE(emblib_list_insert_range(&list, 0, elements, ARRAY_LEN(elements)));
+    EXPECT_TRUE(emblib_list_insert_range(&list, 2, block, ARRAY_LEN(block)));
+
+    for (int i = 0; i < 8; ++i) {
+        int value;
+        EXPECT_TRUE(emblib_list_get(&list, i, &value));
+        EXPECT_EQ(value, i + 1);
+    }
+
+    int removed[5];
+    EXPECT_TRUE(emblib_list_remove_range(&list, 1, removed, ARRAY_LEN(removed)));
+    int values[3];
+    EXPECT_TRUE(emblib_list_get_range(&list, 0, values, ARRAY_LEN(values)));
+    int expected[] = {1, 7, 8};
+    EXPECT_EQ(memcmp(values, expected, sizeof(expected)), 0);
+}
+
+static int int_order(void *left, void *right) {
+    int l = *(int *) left;
+    int r = *(int *) right;
+    return (l > r) - (l < r);
+}
+
+TEST_F(ListTest, SortWrappedStorage) {
+    int dummy = 0;
+    for (int i = 0; i < 6; ++i) {
+        emblib_circ_buffer_insert(&list, &dummy);
+        emblib_circ_buffer_retrieve(&list, &dummy);
+    }
+
+    int elements[] = {9, -3, 7, 0, 4, 4, 12, -8};
+    emblib_list_insert_range(&list, 0, elements, ARRAY_LEN(elements));
+    emblib_list_sort(&list, int_order);
+
+    int expected[] = {-8, -3, 0, 4, 4, 7, 9, 12};
+    int values[8];
+    EXPECT_TRUE(emblib_list_get_range(&list, 0, values, ARRAY_LEN(values)));
+    EXPECT_EQ(memcmp(values, expected, sizeof(expected)), 0);
+    EXPECT_EQ(emblib_list_linearize(&list), (void *) buffer);
+    EXPECT_EQ(memcmp(buffer, expected, sizeof(expected)), 0);
+}
+
+TEST_F(ListTest, RadixSort) {
+    int elements[] = {5, -1, 3, -100, 42, 0};
+    int scratch[ARRAY_LEN(elements)];
+    emblib_list_insert_range(&list, 0, elements, ARRAY_LEN(elements));
+
+    EXPECT_FALSE(emblib_list_radix_sort(&list, true, scratch, sizeof(scratch) - 1));
+    EXPECT_TRUE(emblib_list_radix_sort(&list, true, scratch, sizeof(scratch)));
+
+    int expected[] = {-100, -1, 0, 3, 5, 42};
+    int values[6];
+    EXPECT_TRUE(emblib_list_get_range(&list, 0, values, ARRAY_LEN(values)));
+    EXPECT_EQ(memcmp(values, expected, sizeof(expected)), 0);
+}
+
+TEST_F(ListTest, SortedMode) {
+    int elements[] = {8, 1, 5, 3, 5};
+    for (size_t i = 0; i < ARRAY_LEN(elements); ++i) {
+        EXPECT_TRUE(emblib_list_insert_sorted(&list, &elements[i], int_order));
+    }
+
+    int expected[] = {1, 3, 5, 5, 8};
+    int values[5];
+    EXPECT_TRUE(emblib_list_get_range(&list, 0, values, ARRAY_LEN(values)));
+    EXPECT_EQ(memcmp(values, expected, sizeof(expected)), 0);
+
+    size_t index = 0;
+    int key = 5;
+    EXPECT_TRUE(emblib_list_find_sorted(&list, &key, int_order, &index));
+    EXPECT_EQ(index, 2);
+    key = 4;
+    EXPECT_FALSE(emblib_list_find_sorted(&list, &key, int_order, &index));
+    EXPECT_EQ(emblib_list_lower_bound(&list, &key, int_order), 2);
+    key = 100;
+    EXPECT_EQ(emblib_list_lower_bound(&list, &key, int_order), 5);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,157 @@
+extern "C" {
+#include "emblib_map.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <map>
+#include <random>
+#include <string.h>
+#include <vector>
+
+typedef struct _stats_t {
+    uint64_t bytes;
+    uint32_t packets;
+} stats_t;
+
+static uint64_t u16_hash(void *key) {
+    return (uint64_t) *(uint16_t *) key * 0x9E3779B97F4A7C15ull >> 20;
+}
+
+static bool u16_equals(void *left, void *right) {
+    return *(uint16_t *) left == *(uint16_t *) right;
+}
+
+TEST(map_test, slot_layout) {
+    // the value of a slot keeps its natural alignment
+    ASSERT_EQ(emblib_map_slot_size(sizeof(uint16_t), sizeof(stats_t)), 24);
+    ASSERT_EQ(emblib_map_slot_size(sizeof(uint16_t), sizeof(uint16_t)), 4);
+    ASSERT_EQ(emblib_map_slot_size(3, 4), 8);
+
+    emblib_map_t map;
+    uint64_t buffer[32];
+    ASSERT_TRUE(emblib_map_init(&map, buffer, sizeof(buffer), sizeof(uint16_t), sizeof(stats_t), u16_hash,
+                                u16_equals));
+    ASSERT_EQ(map.value_offset, 8);
+    ASSERT_EQ(map.capacity, 8);
+    ASSERT_EQ(emblib_map_size(&map), 7);
+    ASSERT_TRUE(emblib_map_is_empty(&map));
+}
+
+TEST(map_test, get_or_insert) {
+    emblib_map_t map;
+    uint64_t buffer[128];
+    emblib_map_init(&map, buffer, sizeof(buffer), sizeof(uint16_t), sizeof(stats_t), u16_hash, u16_equals);
+
+    uint16_t key = 80;
+    bool inserted = false;
+    stats_t *stats = (stats_t *) emblib_map_get_or_insert(&map, &key, &inserted);
+    ASSERT_NE(stats, nullptr);
+    ASSERT_TRUE(inserted);
+    ASSERT_EQ(stats->packets, 0);
+    ASSERT_EQ((uintptr_t) stats % alignof(stats_t), 0);
+    stats->packets++;
+    stats->bytes += 1500;
+
+    stats = (stats_t *) emblib_map_get_or_insert(&map, &key, &inserted);
+    ASSERT_FALSE(inserted);
+    stats->packets++;
+
+    stats = (stats_t *) emblib_map_get(&map, &key);
+    ASSERT_EQ(stats->packets, 2);
+    ASSERT_EQ(stats->bytes, 1500);
+    ASSERT_EQ(emblib_map_count(&map), 1);
+
+    key = 443;
+    ASSERT_EQ(emblib_map_get(&map, &key), nullptr);
+}
+
+TEST(map_test, put_remove) {
+    emblib_map_t map;
+    uint64_t buffer[128];
+    emblib_map_init(&map, buffer, sizeof(buffer), sizeof(uint16_t), sizeof(uint16_t), u16_hash, u16_equals);
+
+    for (uint16_t k = 0; k < emblib_map_size(&map); k++) {
+        uint16_t v = k * 10;
+        ASSERT_TRUE(emblib_map_put(&map, &k, &v));
+    }
+    ASSERT_TRUE(emblib_map_is_full(&map));
+    uint16_t extra = 1000;
+    ASSERT_FALSE(emblib_map_put(&map, &extra, &extra));
+
+    uint16_t key = 3, value = 0;
+    uint16_t updated = 7;
+    ASSERT_TRUE(emblib_map_put(&map, &key, &updated));
+    ASSERT_TRUE(emblib_map_remove(&map, &key, &value));
+    ASSERT_EQ(value, 7);
+    ASSERT_FALSE(emblib_map_remove(&map, &key, NULL));
+    ASSERT_TRUE(emblib_map_put(&map, &extra, &extra));
+
+    emblib_map_flush(&map);
+    ASSERT_TRUE(emblib_map_is_empty(&map));
+    ASSERT_EQ(emblib_map_get(&map, &extra), nullptr);
+}
+
+static uint64_t u16_same_hash(void *key) {
+    (void) key;
+    return 0;
+}
+
+TEST(map_test, probe_distance_cap) {
+    // every key collides: the 256th can not be recorded although the map has room
+    emblib_map_t map;
+    std::vector<uint32_t> buffer(1024 * 5);
+    ASSERT_TRUE(emblib_map_init(&map, buffer.data(), buffer.size() * sizeof(uint32_t), sizeof(uint16_t),
+                                sizeof(uint16_t), u16_same_hash, u16_equals));
+    ASSERT_GT(emblib_map_size(&map), 256);
+
+    for (uint16_t key = 0; key < 255; key++) {
+        ASSERT_TRUE(emblib_map_put(&map, &key, &key));
+    }
+    uint16_t key = 255;
+    bool inserted = true;
+    ASSERT_EQ(emblib_map_get_or_insert(&map, &key, &inserted), nullptr);
+    ASSERT_FALSE(inserted);
+    ASSERT_FALSE(emblib_map_put(&map, &key, &key));
+
+    // removing a key frees a distance for another one
+    key = 0;
+    ASSERT_TRUE(emblib_map_remove(&map, &key, NULL));
+    key = 255;
+    ASSERT_TRUE(emblib_map_put(&map, &key, &key));
+    key = 254;
+    ASSERT_EQ(*(uint16_t *) emblib_map_get(&map, &key), 254);
+}
+
+TEST(map_test, against_reference) {
+    emblib_map_t map;
+    std::vector<uint64_t> buffer(1024 * 5 / 8 + 1);
+    ASSERT_TRUE(emblib_map_init(&map, buffer.data(), buffer.size() * sizeof(uint64_t), sizeof(uint16_t),
+                                sizeof(uint16_t), u16_hash, u16_equals));
+
+    std::mt19937 rng(5);
+    std::map<uint16_t, uint16_t> reference;
+    for (int i = 0; i < 100000; i++) {
+        uint16_t k = rng() % 2000;
+        uint16_t v = (uint16_t) rng();
+        if (reference.size() < 800 && (rng() & 1)) {
+            ASSERT_TRUE(emblib_map_put(&map, &k, &v));
+            reference[k] = v;
+        } else {
+            ASSERT_EQ(emblib_map_remove(&map, &k, NULL), reference.erase(k) == 1);
+        }
+    }
+    ASSERT_EQ(emblib_map_count(&map), reference.size());
+    for (auto &kv : reference) {
+        uint16_t k = kv.first;
+        uint16_t *v = (uint16_t *) emblib_map_get(&map, &k);
+        ASSERT_NE(v, nullptr);
+        ASSERT_EQ(*v, kv.second);
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,109 @@
+extern "C" {
+#include "emblib_mlqueue.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <deque>
+#include <random>
+#include <vector>
+
+static void int_copy(void *dest, void *src) {
+    *(int *) dest = *(int *) src;
+}
+
+TEST(mlqueue_test, init) {
+    emblib_mlqueue_t mlqueue;
+    int buffer[40];
+    ASSERT_TRUE(emblib_mlqueue_init(&mlqueue, buffer, sizeof(buffer), 4, sizeof(int), int_copy, NULL));
+    ASSERT_EQ(emblib_mlqueue_size(&mlqueue), 10);
+    ASSERT_TRUE(emblib_mlqueue_is_empty(&mlqueue));
+
+    ASSERT_FALSE(emblib_mlqueue_init(&mlqueue, buffer, sizeof(buffer), 0, sizeof(int), int_copy, NULL));
+    ASSERT_FALSE(emblib_mlqueue_init(&mlqueue, buffer, sizeof(buffer), 33, sizeof(int), int_copy, NULL));
+    ASSERT_FALSE(emblib_mlqueue_init(&mlqueue, buffer, 3 * sizeof(int), 4, sizeof(int), int_copy, NULL));
+    ASSERT_FALSE(emblib_mlqueue_init(&mlqueue, buffer, sizeof(buffer), 4, sizeof(int), NULL, NULL));
+}
+
+TEST(mlqueue_test, priority_then_fifo) {
+    emblib_mlqueue_t mlqueue;
+    int buffer[3 * 32];
+    ASSERT_TRUE(emblib_mlqueue_init(&mlqueue, buffer, sizeof(buffer), 32, sizeof(int), int_copy, NULL));
+
+    const struct { size_t level; int value; } in[] = {{0, 1}, {31, 2}, {5, 3}, {31, 4}, {0, 5}, {5, 6}};
+    for (auto e : in) {
+        int value = e.value;
+        ASSERT_TRUE(emblib_mlqueue_enqueue(&mlqueue, e.level, &value));
+    }
+    int value = 0;
+    ASSERT_FALSE(emblib_mlqueue_enqueue(&mlqueue, 32, &value));
+    ASSERT_EQ(emblib_mlqueue_count(&mlqueue), 6);
+    ASSERT_EQ(emblib_mlqueue_count_level(&mlqueue, 5), 2);
+
+    size_t level;
+    ASSERT_TRUE(emblib_mlqueue_peek(&mlqueue, &value, &level));
+    ASSERT_EQ(value, 2);
+    ASSERT_EQ(level, 31);
+
+    const int expected[] = {2, 4, 3, 6, 1, 5};
+    for (int e : expected) {
+        ASSERT_TRUE(emblib_mlqueue_dequeue(&mlqueue, &value, NULL));
+        ASSERT_EQ(value, e);
+    }
+    ASSERT_FALSE(emblib_mlqueue_dequeue(&mlqueue, &value, &level));
+    ASSERT_TRUE(emblib_mlqueue_is_empty(&mlqueue));
+}
+
+TEST(mlqueue_test, full_level_and_flush) {
+    emblib_mlqueue_t mlqueue;
+    int buffer[2 * 3];
+    ASSERT_TRUE(emblib_mlqueue_init(&mlqueue, buffer, sizeof(buffer), 3, sizeof(int), int_copy, NULL));
+
+    int value = 7;
+    ASSERT_TRUE(emblib_mlqueue_enqueue(&mlqueue, 1, &value));
+    ASSERT_TRUE(emblib_mlqueue_enqueue(&mlqueue, 1, &value));
+    // a full level does not spill into the others
+    ASSERT_FALSE(emblib_mlqueue_enqueue(&mlqueue, 1, &value));
+    ASSERT_TRUE(emblib_mlqueue_enqueue(&mlqueue, 2, &value));
+
+    emblib_mlqueue_flush(&mlqueue);
+    ASSERT_TRUE(emblib_mlqueue_is_empty(&mlqueue));
+    ASSERT_FALSE(emblib_mlqueue_peek(&mlqueue, &value, NULL));
+    ASSERT_TRUE(emblib_mlqueue_enqueue(&mlqueue, 0, &value));
+    ASSERT_TRUE(emblib_mlqueue_dequeue(&mlqueue, &value, NULL));
+}
+
+TEST(mlqueue_test, against_reference) {
+    const size_t levels = 8, per_level = 16;
+    emblib_mlqueue_t mlqueue;
+    std::vector<int> buffer(levels * per_level);
+    ASSERT_TRUE(emblib_mlqueue_init(&mlqueue, buffer.data(), buffer.size() * sizeof(int), levels, sizeof(int),
+                                    int_copy, NULL));
+
+    std::mt19937 rng(9);
+    std::deque<int> ref[levels];
+    for (int i = 0; i < 50000; i++) {
+        if (rng() % 2) {
+            const size_t level = rng() % levels;
+            ASSERT_EQ(emblib_mlqueue_enqueue(&mlqueue, level, &i), ref[level].size() < per_level);
+            if (ref[level].size() < per_level) ref[level].push_back(i);
+        } else {
+            int value;
+            size_t level;
+            int top = (int) levels - 1;
+            while (top >= 0 && ref[top].empty()) top--;
+            ASSERT_EQ(emblib_mlqueue_dequeue(&mlqueue, &value, &level), top >= 0);
+            if (top >= 0) {
+                ASSERT_EQ(level, (size_t) top);
+                ASSERT_EQ(value, ref[top].front());
+                ref[top].pop_front();
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
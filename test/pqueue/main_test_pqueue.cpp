@@ -0,0 +1,101 @@
+extern "C" {
+#include "emblib_pqueue.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string.h>
+#include <vector>
+
+static void int_copy(void *dest, void *src) {
+    if (dest && src) {
+        memcpy(dest, src, sizeof(int));
+    }
+}
+
+static int int_cmp(void *left, void *right) {
+    return (*(int *) left > *(int *) right) - (*(int *) left < *(int *) right);
+}
+
+static int int_min_cmp(void *left, void *right) {
+    return int_cmp(right, left);
+}
+
+TEST(pqueue_test, init) {
+    emblib_pqueue_t pqueue;
+    int array[8];
+    ASSERT_TRUE(emblib_pqueue_init(&pqueue, array, sizeof(array), sizeof(int), int_copy, NULL, int_cmp));
+    ASSERT_EQ(emblib_pqueue_size(&pqueue), 8);
+    ASSERT_TRUE(emblib_pqueue_is_empty(&pqueue));
+
+    ASSERT_FALSE(emblib_pqueue_init(&pqueue, array, sizeof(array) - 1, sizeof(int), int_copy, NULL, int_cmp));
+    ASSERT_FALSE(emblib_pqueue_init(&pqueue, array, sizeof(array), sizeof(int), int_copy, NULL, NULL));
+}
+
+TEST(pqueue_test, push_pop_order) {
+    emblib_pqueue_t pqueue;
+    int array[8];
+    emblib_pqueue_init(&pqueue, array, sizeof(array), sizeof(int), int_copy, NULL, int_cmp);
+
+    const int values[] = {5, 1, 9, 3, 9, 7, 2, 8};
+    for (int v : values) {
+        ASSERT_TRUE(emblib_pqueue_push(&pqueue, (void *) &v));
+    }
+    int data = 0;
+    ASSERT_FALSE(emblib_pqueue_push(&pqueue, &data));
+    ASSERT_TRUE(emblib_pqueue_is_full(&pqueue));
+
+    ASSERT_TRUE(emblib_pqueue_peek(&pqueue, &data));
+    ASSERT_EQ(data, 9);
+    const int expected[] = {9, 9, 8, 7, 5, 3, 2, 1};
+    for (int e : expected) {
+        ASSERT_TRUE(emblib_pqueue_pop(&pqueue, &data));
+        ASSERT_EQ(data, e);
+    }
+    ASSERT_FALSE(emblib_pqueue_pop(&pqueue, &data));
+    ASSERT_FALSE(emblib_pqueue_peek(&pqueue, &data));
+}
+
+TEST(pqueue_test, heapify_and_push_n) {
+    std::mt19937 rng(1);
+    std::vector<int> array(1000);
+    for (int &v : array) v = (int) (rng() % 500);
+    std::vector<int> reference(array.begin(), array.begin() + 600);
+
+    emblib_pqueue_t pqueue;
+    emblib_pqueue_init(&pqueue, array.data(), array.size() * sizeof(int), sizeof(int), int_copy, NULL,
+                       int_min_cmp);
+    ASSERT_FALSE(emblib_pqueue_heapify(&pqueue, 1001));
+    ASSERT_TRUE(emblib_pqueue_heapify(&pqueue, 600));
+
+    // a small batch is sifted in, a large one triggers a rebuild
+    std::vector<int> batch(400);
+    for (int &v : batch) v = (int) (rng() % 500);
+    ASSERT_TRUE(emblib_pqueue_push_n(&pqueue, batch.data(), 10));
+    ASSERT_FALSE(emblib_pqueue_push_n(&pqueue, batch.data(), 391));
+    reference.insert(reference.end(), batch.begin(), batch.begin() + 10);
+
+    int data;
+    for (int i = 0; i < 300; i++) emblib_pqueue_pop(&pqueue, &data);
+    std::sort(reference.begin(), reference.end());
+    reference.erase(reference.begin(), reference.begin() + 300);
+    ASSERT_TRUE(emblib_pqueue_push_n(&pqueue, batch.data() + 10, 390));
+    reference.insert(reference.end(), batch.begin() + 10, batch.end());
+    std::sort(reference.begin(), reference.end());
+
+    ASSERT_EQ(emblib_pqueue_count(&pqueue), reference.size());
+    for (int e : reference) {
+        ASSERT_TRUE(emblib_pqueue_pop(&pqueue, &data));
+        ASSERT_EQ(data, e);
+    }
+    ASSERT_TRUE(emblib_pqueue_is_empty(&pqueue));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,106 @@
+extern "C" {
+#include "emblib_scheduler.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <vector>
+
+class SchedulerTest : public ::testing::Test {
+protected:
+    emblib_scheduler_t scheduler;
+    emblib_worker_t workers[4];
+    emblib_task_t tasks[5 * 256];
+
+    void SetUp() override {
+        ASSERT_TRUE(emblib_scheduler_init(&scheduler, workers, 4, tasks, sizeof(tasks)));
+    }
+
+    void TearDown() override {
+        emblib_scheduler_destroy(&scheduler);
+    }
+};
+
+static std::atomic<int> counter;
+
+static void count_task(void *arg) {
+    counter.fetch_add((int) (intptr_t) arg);
+}
+
+TEST_F(SchedulerTest, SpawnFromOutside) {
+    // many more tasks than the injection queue holds: the overflow runs in the caller
+    counter = 0;
+    emblib_task_group_t group;
+    emblib_task_group_init(&group);
+    for (int i = 0; i < 100000; i++) {
+        ASSERT_TRUE(emblib_scheduler_spawn(&scheduler, &group, count_task, (void *) (intptr_t) 1));
+    }
+    emblib_scheduler_wait(&scheduler, &group);
+    ASSERT_EQ(counter.load(), 100000);
+    ASSERT_EQ(group.pending, 0);
+
+    ASSERT_FALSE(emblib_scheduler_spawn(&scheduler, &group, NULL, NULL));
+}
+
+typedef struct _fib_t {
+    emblib_scheduler_t *scheduler;
+    int n;
+    long result;
+} fib_t;
+
+static void fib_task(void *arg) {
+    fib_t *fib = (fib_t *) arg;
+    if (fib->n < 2) {
+        fib->result = fib->n;
+        return;
+    }
+
+    // nested fork-join: the waiting worker runs tasks instead of blocking
+    fib_t left = {fib->scheduler, fib->n - 1, 0};
+    fib_t right = {fib->scheduler, fib->n - 2, 0};
+    emblib_task_group_t group;
+    emblib_task_group_init(&group);
+    emblib_scheduler_spawn(fib->scheduler, &group, fib_task, &left);
+    fib_task(&right);
+    emblib_scheduler_wait(fib->scheduler, &group);
+    fib->result = left.result + right.result;
+}
+
+TEST_F(SchedulerTest, NestedForkJoin) {
+    fib_t fib = {&scheduler, 24, 0};
+    emblib_task_group_t group;
+    emblib_task_group_init(&group);
+    emblib_scheduler_spawn(&scheduler, &group, fib_task, &fib);
+    emblib_scheduler_wait(&scheduler, &group);
+    ASSERT_EQ(fib.result, 46368);
+}
+
+TEST_F(SchedulerTest, ParkAndWake) {
+    // workers park between bursts and must wake up for each one
+    counter = 0;
+    for (int burst = 0; burst < 50; burst++) {
+        emblib_task_group_t group;
+        emblib_task_group_init(&group);
+        for (int i = 0; i < 10; i++) {
+            emblib_scheduler_spawn(&scheduler, &group, count_task, (void *) (intptr_t) 1);
+        }
+        emblib_scheduler_wait(&scheduler, &group);
+    }
+    ASSERT_EQ(counter.load(), 500);
+}
+
+TEST(SchedulerInitTest, InvalidArguments) {
+    emblib_scheduler_t scheduler;
+    emblib_worker_t workers[2];
+    emblib_task_t tasks[2];
+    ASSERT_FALSE(emblib_scheduler_init(&scheduler, workers, 0, tasks, sizeof(tasks)));
+    ASSERT_FALSE(emblib_scheduler_init(&scheduler, workers, 2, tasks, sizeof(tasks)));
+    ASSERT_FALSE(emblib_scheduler_init(&scheduler, NULL, 2, tasks, sizeof(tasks)));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
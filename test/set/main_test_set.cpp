@@ -88,6 +88,236 @@ TEST(SetTest, ClearSet) {
     ASSERT_FALSE(emblib_set_contains(&set, &elem2));
 }
 
+static int int_order(void *left, void *right) {
+    int l = *(int *) left;
+    int r = *(int *) right;
+    return (l > r) - (l < r);
+}
+
+TEST(SetTest, SortedAddRemove) {
+    emblib_set_t set;
+    int array[10];
+    ASSERT_TRUE(emblib_set_init_sorted(&set, array, sizeof(array), sizeof(int), int_copy, int_free, int_order));
+
+    int elements[] = {7, 3, 9, 1};
+    for (size_t i = 0; i < ARRAY_LEN(elements); i++) {
+        ASSERT_TRUE(emblib_set_add(&set, &elements[i]));
+    }
+    ASSERT_FALSE(emblib_set_add(&set, &elements[2]));
+
+    int expected[] = {1, 3, 7, 9};
+    ASSERT_EQ(memcmp(array, expected, sizeof(expected)), 0);
+
+    int missing = 4;
+    ASSERT_TRUE(emblib_set_contains(&set, &elements[0]));
+    ASSERT_FALSE(emblib_set_contains(&set, &missing));
+    ASSERT_TRUE(emblib_set_remove(&set, &elements[1]));
+    ASSERT_FALSE(emblib_set_remove(&set, &missing));
+    ASSERT_FALSE(emblib_set_contains(&set, &elements[1]));
+    ASSERT_EQ(emblib_set_count(&set), 3);
+}
+
+TEST(SetTest, SortedAddMany) {
+    emblib_set_t set;
+    int array[10];
+    emblib_set_init_sorted(&set, array, sizeof(array), sizeof(int), int_copy, int_free, int_order);
+
+    int initial[] = {10, 2, 6};
+    ASSERT_TRUE(emblib_set_add_many(&set, initial, ARRAY_LEN(initial)));
+
+    int batch[] = {8, 2, 1, 11, 8, 6, 4};
+    ASSERT_TRUE(emblib_set_add_many(&set, batch, ARRAY_LEN(batch)));
+    ASSERT_EQ(emblib_set_count(&set), 7);
+
+    int expected[] = {1, 2, 4, 6, 8, 10, 11};
+    ASSERT_EQ(memcmp(array, expected, sizeof(expected)), 0);
+
+    // 4 new elements do not fit: nothing is added
+    int overflow[] = {20, 21, 22, 23, 1};
+    ASSERT_FALSE(emblib_set_add_many(&set, overflow, ARRAY_LEN(overflow)));
+    ASSERT_EQ(emblib_set_count(&set), 7);
+    ASSERT_EQ(memcmp(array, expected, sizeof(expected)), 0);
+
+    int fits[] = {1, 20, 21, 22, 11};
+    ASSERT_TRUE(emblib_set_add_many(&set, fits, ARRAY_LEN(fits)));
+    ASSERT_TRUE(emblib_set_is_full(&set));
+}
+
+TEST(SetTest, UnsortedAddMany) {
+    emblib_set_t set;
+    int array[4];
+    emblib_set_init(&set, array, sizeof(array), sizeof(int), int_copy, int_free, int_cmp);
+
+    int batch[] = {5, 3, 5, 8};
+    ASSERT_TRUE(emblib_set_add_many(&set, batch, ARRAY_LEN(batch)));
+    ASSERT_EQ(emblib_set_count(&set), 3);
+
+    int more[] = {1, 2};
+    ASSERT_FALSE(emblib_set_add_many(&set, more, ARRAY_LEN(more)));
+}
+
+static bool set_has(emblib_set_t *set, std::initializer_list<int> values) {
+    if (emblib_set_count(set) != values.size()) return false;
+    for (int v : values) {
+        if (!emblib_set_contains(set, &v)) return false;
+    }
+    return true;
+}
+
+class SetAlgebraTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        emblib_set_init(&a, array_a, sizeof(array_a), sizeof(int), int_copy, int_free, int_cmp);
+        emblib_set_init(&b, array_b, sizeof(array_b), sizeof(int), int_copy, int_free, int_cmp);
+        emblib_set_init(&out, array_out, sizeof(array_out), sizeof(int), int_copy, int_free, int_cmp);
+
+        int elements_a[] = {9, 1, 5, 3, 7};
+        int elements_b[] = {4, 5, 6, 3};
+        emblib_set_add_many(&a, elements_a, ARRAY_LEN(elements_a));
+        emblib_set_add_many(&b, elements_b, ARRAY_LEN(elements_b));
+    }
+
+    emblib_set_t a, b, out;
+    int array_a[8], array_b[8], array_out[10];
+    int scratch[16];
+};
+
+TEST_F(SetAlgebraTest, Union) {
+    ASSERT_TRUE(emblib_set_union(&a, &b, &out, scratch, sizeof(scratch)));
+    ASSERT_TRUE(set_has(&out, {1, 3, 4, 5, 6, 7, 9}));
+}
+
+TEST_F(SetAlgebraTest, OperandsKeepTheirOrder) {
+    ASSERT_TRUE(emblib_set_union(&a, &b, &out, scratch, sizeof(scratch)));
+    ASSERT_TRUE(emblib_set_is_subset(&b, &out, scratch, sizeof(scratch)));
+
+    const int order_a[] = {9, 1, 5, 3, 7};
+    for (size_t i = 0; i < ARRAY_LEN(order_a); i++) {
+        int value;
+        ASSERT_TRUE(emblib_list_get(&a.list, i, &value));
+        ASSERT_EQ(value, order_a[i]);
+    }
+    ASSERT_FALSE(a.sorted);
+}
+
+TEST_F(SetAlgebraTest, WrappedOperand) {
+    // drop 9 from the front of the ring so that the storage of a wraps
+    int nine;
+    ASSERT_TRUE(emblib_circ_buffer_retrieve(&a.list, &nine));
+    int more[] = {2, 4, 6, 8};
+    ASSERT_TRUE(emblib_set_add_many(&a, more, ARRAY_LEN(more)));
+    ASSERT_TRUE(emblib_set_is_full(&a));
+    ASSERT_NE(a.list.head, 0);
+
+    ASSERT_TRUE(emblib_set_union(&a, &b, &out, scratch, sizeof(scratch)));
+    ASSERT_TRUE(set_has(&out, {1, 2, 3, 4, 5, 6, 7, 8}));
+    ASSERT_TRUE(emblib_set_is_subset(&b, &a, scratch, sizeof(scratch)));
+}
+
+TEST_F(SetAlgebraTest, ScratchTooSmall) {
+    ASSERT_FALSE(emblib_set_union(&a, &b, &out, NULL, 0));
+    ASSERT_FALSE(emblib_set_union(&a, &b, &out, scratch, 8 * sizeof(int)));
+
+    // sorted operands are read in place
+    emblib_set_t sa, sb;
+    int array_sa[8], array_sb[8];
+    emblib_set_init_sorted(&sa, array_sa, sizeof(array_sa), sizeof(int), int_copy, int_free, int_cmp);
+    emblib_set_init_sorted(&sb, array_sb, sizeof(array_sb), sizeof(int), int_copy, int_free, int_cmp);
+    int elements[] = {2, 4, 6};
+    emblib_set_add_many(&sa, elements, 2);
+    emblib_set_add_many(&sb, elements, 3);
+    ASSERT_TRUE(emblib_set_is_subset(&sa, &sb, NULL, 0));
+    ASSERT_TRUE(emblib_set_difference(&sb, &sa, &out, NULL, 0));
+    ASSERT_TRUE(set_has(&out, {6}));
+}
+
+TEST_F(SetAlgebraTest, Intersection) {
+    ASSERT_TRUE(emblib_set_intersection(&a, &b, &out, scratch, sizeof(scratch)));
+    ASSERT_TRUE(set_has(&out, {3, 5}));
+}
+
+TEST_F(SetAlgebraTest, Difference) {
+    ASSERT_TRUE(emblib_set_difference(&a, &b, &out, scratch, sizeof(scratch)));
+    ASSERT_TRUE(set_has(&out, {1, 7, 9}));
+    ASSERT_TRUE(emblib_set_difference(&b, &a, &out, scratch, sizeof(scratch)));
+    ASSERT_TRUE(set_has(&out, {4, 6}));
+}
+
+TEST_F(SetAlgebraTest, Subset) {
+    ASSERT_FALSE(emblib_set_is_subset(&a, &b, scratch, sizeof(scratch)));
+    ASSERT_TRUE(emblib_set_intersection(&a, &b, &out, scratch, sizeof(scratch)));
+    ASSERT_TRUE(emblib_set_is_subset(&out, &a, scratch, sizeof(scratch)));
+    ASSERT_TRUE(emblib_set_is_subset(&out, &b, scratch, sizeof(scratch)));
+    emblib_set_flush(&out);
+    ASSERT_TRUE(emblib_set_is_subset(&out, &a, scratch, sizeof(scratch)));
+}
+
+TEST_F(SetAlgebraTest, OutputTooSmall) {
+    emblib_set_t small;
+    int array_small[4];
+    emblib_set_init(&small, array_small, sizeof(array_small), sizeof(int), int_copy, int_free, int_cmp);
+    ASSERT_FALSE(emblib_set_union(&a, &b, &small, scratch, sizeof(scratch)));
+    ASSERT_TRUE(emblib_set_is_empty(&small));
+    ASSERT_FALSE(emblib_set_union(&a, &b, &a, scratch, sizeof(scratch)));
+}
+
+TEST_F(SetAlgebraTest, SortedOutput) {
+    emblib_set_t sorted;
+    int array_sorted[10];
+    emblib_set_init_sorted(&sorted, array_sorted, sizeof(array_sorted), sizeof(int), int_copy, int_free, int_cmp);
+    ASSERT_TRUE(emblib_set_union(&a, &b, &sorted, scratch, sizeof(scratch)));
+
+    // int_cmp orders from the largest to the smallest
+    int expected[] = {9, 7, 6, 5, 4, 3, 1};
+    ASSERT_EQ(memcmp(array_sorted, expected, sizeof(expected)), 0);
+    int three = 3;
+    ASSERT_TRUE(emblib_set_contains(&sorted, &three));
+}
+
+static uint64_t int_hash(void *data) {
+    return (uint64_t) (uint32_t) *(int *) data * 0x9E3779B97F4A7C15ull;
+}
+
+TEST(SetTest, BloomFilter) {
+    emblib_set_t set;
+    int array[10];
+    emblib_set_init(&set, array, sizeof(array), sizeof(int), int_copy, int_free, int_cmp);
+
+    int elem1 = 42;
+    int elem2 = 43;
+    emblib_set_add(&set, &elem1);
+
+    emblib_bloom_t bloom;
+    uint32_t bits[8];
+    ASSERT_TRUE(emblib_bloom_init(&bloom, bits, sizeof(bits), 3, int_hash));
+    ASSERT_TRUE(emblib_set_attach_bloom(&set, &bloom));
+
+    // elements present before the attach are in the filter
+    ASSERT_TRUE(emblib_bloom_maybe_contains(&bloom, &elem1));
+    ASSERT_TRUE(emblib_set_contains(&set, &elem1));
+    ASSERT_FALSE(emblib_bloom_maybe_contains(&bloom, &elem2));
+    ASSERT_FALSE(emblib_set_contains(&set, &elem2));
+
+    ASSERT_TRUE(emblib_set_add(&set, &elem2));
+    ASSERT_TRUE(emblib_bloom_maybe_contains(&bloom, &elem2));
+    ASSERT_TRUE(emblib_set_contains(&set, &elem2));
+
+    // the filter may still say yes, the set has the last word
+    ASSERT_TRUE(emblib_set_remove(&set, &elem2));
+    ASSERT_FALSE(emblib_set_contains(&set, &elem2));
+
+    int batch[] = {1, 2, 3};
+    ASSERT_TRUE(emblib_set_add_many(&set, batch, ARRAY_LEN(batch)));
+    ASSERT_TRUE(emblib_bloom_maybe_contains(&bloom, &batch[2]));
+
+    emblib_set_flush(&set);
+    ASSERT_FALSE(emblib_bloom_maybe_contains(&bloom, &elem1));
+
+    ASSERT_TRUE(emblib_set_attach_bloom(&set, NULL));
+    ASSERT_TRUE(emblib_set_add(&set, &elem1));
+    ASSERT_TRUE(emblib_set_contains(&set, &elem1));
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,113 @@
+extern "C" {
+#include "emblib_sort.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+static int int_cmp(void *left, void *right) {
+    int l = *(int *) left;
+    int r = *(int *) right;
+    return (l > r) - (l < r);
+}
+
+typedef struct _record_t {
+    uint32_t key;
+    char name[13];
+} record_t;
+
+static int record_cmp(void *left, void *right) {
+    uint32_t l = ((record_t *) left)->key;
+    uint32_t r = ((record_t *) right)->key;
+    return (l > r) - (l < r);
+}
+
+TEST(sort_test, random_ints) {
+    std::mt19937 rng(1234);
+    for (size_t n : {0, 1, 2, 3, 15, 16, 17, 100, 1000, 10000}) {
+        std::vector<int> v(n);
+        for (auto &x : v) x = (int) (rng() % 2001) - 1000;
+        std::vector<int> expected = v;
+        std::sort(expected.begin(), expected.end());
+
+        emblib_sort(v.data(), v.size(), sizeof(int), int_cmp);
+        ASSERT_EQ(v, expected) << "n = " << n;
+    }
+}
+
+TEST(sort_test, presorted_and_duplicates) {
+    std::vector<int> ascending(5000), descending(5000), equal(5000, 7);
+    for (int i = 0; i < 5000; i++) {
+        ascending[i] = i;
+        descending[i] = 5000 - i;
+    }
+
+    emblib_sort(ascending.data(), ascending.size(), sizeof(int), int_cmp);
+    emblib_sort(descending.data(), descending.size(), sizeof(int), int_cmp);
+    emblib_sort(equal.data(), equal.size(), sizeof(int), int_cmp);
+
+    ASSERT_TRUE(std::is_sorted(ascending.begin(), ascending.end()));
+    ASSERT_TRUE(std::is_sorted(descending.begin(), descending.end()));
+    ASSERT_EQ(equal, std::vector<int>(5000, 7));
+}
+
+TEST(sort_test, odd_sized_records) {
+    record_t records[300];
+    for (uint32_t i = 0; i < ARRAY_LEN(records); i++) {
+        records[i].key = (i * 7919u) % 1000u;
+        snprintf(records[i].name, sizeof(records[i].name), "r%u", records[i].key);
+    }
+
+    emblib_sort(records, ARRAY_LEN(records), sizeof(record_t), record_cmp);
+    for (size_t i = 1; i < ARRAY_LEN(records); i++) {
+        ASSERT_LE(records[i - 1].key, records[i].key);
+    }
+    char name[13];
+    snprintf(name, sizeof(name), "r%u", records[42].key);
+    ASSERT_STREQ(records[42].name, name);
+}
+
+TEST(sort_test, radix_u32) {
+    std::mt19937 rng(99);
+    std::vector<uint32_t> v(4096), scratch(4096);
+    for (auto &x : v) x = rng();
+    std::vector<uint32_t> expected = v;
+    std::sort(expected.begin(), expected.end());
+
+    ASSERT_TRUE(emblib_radix_sort(v.data(), v.size(), sizeof(uint32_t), false, scratch.data(),
+                                  scratch.size() * sizeof(uint32_t)));
+    ASSERT_EQ(v, expected);
+}
+
+TEST(sort_test, radix_i64) {
+    std::mt19937_64 rng(7);
+    std::vector<int64_t> v(3000), scratch(3000);
+    for (auto &x : v) x = (int64_t) rng();
+    v[0] = INT64_MIN;
+    v[1] = INT64_MAX;
+    v[2] = 0;
+    v[3] = -1;
+    std::vector<int64_t> expected = v;
+    std::sort(expected.begin(), expected.end());
+
+    ASSERT_TRUE(emblib_radix_sort(v.data(), v.size(), sizeof(int64_t), true, scratch.data(),
+                                  scratch.size() * sizeof(int64_t)));
+    ASSERT_EQ(v, expected);
+}
+
+TEST(sort_test, radix_invalid) {
+    uint16_t small[4] = {3, 2, 1, 0};
+    uint32_t v[4] = {3, 2, 1, 0};
+    uint32_t scratch[2];
+    ASSERT_FALSE(emblib_radix_sort(small, ARRAY_LEN(small), sizeof(uint16_t), false, scratch, sizeof(scratch)));
+    ASSERT_FALSE(emblib_radix_sort(v, ARRAY_LEN(v), sizeof(uint32_t), false, scratch, sizeof(scratch)));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
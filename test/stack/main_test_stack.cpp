@@ -237,6 +237,56 @@ TEST(stack_test, stack_is_full) {
     EXPECT_TRUE(emblib_stack_is_full(&stack));
 }
 
+TEST(stack_test, stack_lifo_order) {
+    emblib_stack_t stack;
+    uint16_t buffer[4];
+
+    emblib_stack_init(&stack, buffer, sizeof(buffer), sizeof(uint16_t), uint16_copy, uint16_free);
+
+    for (uint16_t i = 1; i <= 4; i++) {
+        ASSERT_TRUE(emblib_stack_push(&stack, &i));
+    }
+    uint16_t data;
+    ASSERT_TRUE(emblib_stack_peek(&stack, &data));
+    ASSERT_EQ(data, 4);
+    for (uint16_t i = 4; i >= 1; i--) {
+        ASSERT_TRUE(emblib_stack_pop(&stack, &data));
+        ASSERT_EQ(data, i);
+    }
+    ASSERT_FALSE(emblib_stack_pop(&stack, &data));
+    ASSERT_FALSE(emblib_stack_peek(&stack, &data));
+
+    // pushes after pops reuse the bottom of the array, no wrap
+    data = 7;
+    ASSERT_TRUE(emblib_stack_push(&stack, &data));
+    ASSERT_EQ(buffer[0], 7);
+}
+
+TEST(stack_test, stack_push_n_pop_n) {
+    emblib_stack_t stack;
+    uint16_t buffer[6];
+    uint16_t block[4] = {1, 2, 3, 4};
+    uint16_t out[4] = {0};
+
+    emblib_stack_init(&stack, buffer, sizeof(buffer), sizeof(uint16_t), uint16_copy, uint16_free);
+
+    ASSERT_TRUE(emblib_stack_push_n(&stack, block, 4));
+    ASSERT_FALSE(emblib_stack_push_n(&stack, block, 3));
+    ASSERT_EQ(emblib_stack_count(&stack), 4);
+
+    uint16_t data = 9;
+    ASSERT_TRUE(emblib_stack_push(&stack, &data));
+    ASSERT_FALSE(emblib_stack_pop_n(&stack, out, 6));
+    ASSERT_TRUE(emblib_stack_pop_n(&stack, out, 3));
+    ASSERT_EQ(out[0], 3);
+    ASSERT_EQ(out[1], 4);
+    ASSERT_EQ(out[2], 9);
+
+    ASSERT_TRUE(emblib_stack_pop(&stack, &data));
+    ASSERT_EQ(data, 2);
+    ASSERT_EQ(emblib_stack_count(&stack), 1);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
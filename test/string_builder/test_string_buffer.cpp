@@ -7,6 +7,7 @@ extern "C"
 }
 
 #include "gtest/gtest.h"
+#include <random>
 #include <sstream>
 
 TEST(string_builder_test, init) {
@@ -71,6 +72,87 @@ TEST(string_builder_test, append_int_ov) {
     ASSERT_STREQ(sb_str(&sb), "INT: 1");
 }
 
+TEST(string_builder_test, append_long_long) {
+    string_builder_t sb;
+    char s[64];
+    sb_init(&sb, s, sizeof(s));
+    ASSERT_TRUE(sb_append_long_long(&sb, -1234567890123LL));
+    ASSERT_STREQ(sb_str(&sb), "-1234567890123");
+}
+
+TEST(string_builder_test, append_int_limits) {
+    string_builder_t sb;
+    char s[128];
+    sb_init(&sb, s, sizeof(s));
+    ASSERT_TRUE(sb_append_int32(&sb, INT32_MIN));
+    sb_append_byte(&sb, ' ');
+    ASSERT_TRUE(sb_append_uint32(&sb, UINT32_MAX));
+    sb_append_byte(&sb, ' ');
+    ASSERT_TRUE(sb_append_int64(&sb, INT64_MIN));
+    sb_append_byte(&sb, ' ');
+    ASSERT_TRUE(sb_append_uint64(&sb, UINT64_MAX));
+    sb_append_byte(&sb, ' ');
+    ASSERT_TRUE(sb_append_int(&sb, 0));
+    ASSERT_STREQ(sb_str(&sb), "-2147483648 4294967295 -9223372036854775808 18446744073709551615 0");
+}
+
+TEST(string_builder_test, append_pad_and_hex) {
+    string_builder_t sb;
+    char s[64];
+    sb_init(&sb, s, sizeof(s));
+    ASSERT_TRUE(sb_append_uint64_pad(&sb, 42, 5));
+    sb_append_byte(&sb, ' ');
+    ASSERT_TRUE(sb_append_int64_pad(&sb, -42, 5));
+    sb_append_byte(&sb, ' ');
+    ASSERT_TRUE(sb_append_uint64_pad(&sb, 123456, 3));
+    sb_append_byte(&sb, ' ');
+    ASSERT_TRUE(sb_append_hex(&sb, 0xBEEF, 0));
+    sb_append_byte(&sb, ' ');
+    ASSERT_TRUE(sb_append_hex(&sb, 0x1A, 8));
+    sb_append_byte(&sb, ' ');
+    ASSERT_TRUE(sb_append_hex(&sb, UINT64_MAX, 0));
+    ASSERT_STREQ(sb_str(&sb), "00042 -0042 123456 beef 0000001a ffffffffffffffff");
+}
+
+TEST(string_builder_test, append_number_ov) {
+    string_builder_t sb;
+    char s[8];
+    sb_init(&sb, s, sizeof(s));
+    sb_append_char_array(&sb, "N: ", sizeof("N: ") - 1);
+    ASSERT_TRUE(sb_append_int64_pad(&sb, -7, 10));
+    ASSERT_STREQ(sb_str(&sb), "N: -000");
+    ASSERT_FALSE(sb_append_uint32(&sb, 1));
+    ASSERT_STREQ(sb_str(&sb), "N: -000");
+
+    sb_init(&sb, s, sizeof(s));
+    ASSERT_TRUE(sb_append_uint64(&sb, 123456789));
+    ASSERT_STREQ(sb_str(&sb), "1234567");
+}
+
+TEST(string_builder_test, append_int_matches_printf) {
+    std::mt19937_64 rng(12);
+    for (int i = 0; i < 20000; i++) {
+        // spread the values over every digit count
+        const uint64_t u = rng() >> (rng() % 64);
+        const int64_t v = (int64_t) (rng() >> (rng() % 64)) * ((rng() % 2) ? 1 : -1);
+        const size_t width = rng() % 24;
+        char expected[128], s[128];
+        snprintf(expected, sizeof(expected), "%" PRIu64 "|%" PRId64 "|%0*" PRId64 "|%0*" PRIx64,
+                 u, v, (int) width, v, (int) width, u);
+
+        string_builder_t sb;
+        sb_init(&sb, s, sizeof(s));
+        sb_append_uint64(&sb, u);
+        sb_append_byte(&sb, '|');
+        sb_append_int64(&sb, v);
+        sb_append_byte(&sb, '|');
+        sb_append_int64_pad(&sb, v, width);
+        sb_append_byte(&sb, '|');
+        sb_append_hex(&sb, u, width);
+        ASSERT_STREQ(sb_str(&sb), expected);
+    }
+}
+
 TEST(string_builder_test, append_byte) {
     string_builder_t sb;
     char s[8];
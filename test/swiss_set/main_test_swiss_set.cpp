@@ -0,0 +1,108 @@
+extern "C" {
+#include "emblib_swiss_set.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <random>
+#include <set>
+#include <string.h>
+#include <vector>
+
+static void u32_copy(void *dest, void *src) {
+    if (dest && src) {
+        memcpy(dest, src, sizeof(uint32_t));
+    }
+}
+
+static int u32_cmp(void *left, void *right) {
+    return *(uint32_t *) left != *(uint32_t *) right;
+}
+
+static uint64_t u32_hash(void *data) {
+    uint64_t h = *(uint32_t *) data * 0x9E3779B97F4A7C15ull;
+    return h ^ (h >> 29);
+}
+
+// only 4 distinct hashes: many 7-bit matches and long probe sequences
+static uint64_t weak_hash(void *data) {
+    return (*(uint32_t *) data & 3u) * 0x1234567ull;
+}
+
+TEST(SwissSetTest, Initialization) {
+    emblib_swiss_set_t set;
+    uint8_t buffer[64 * (sizeof(uint32_t) + 1)];
+    ASSERT_TRUE(emblib_swiss_set_init(&set, buffer, sizeof(buffer), sizeof(uint32_t), u32_copy, NULL, u32_cmp,
+                                      u32_hash));
+    ASSERT_EQ(set.capacity, 64);
+    ASSERT_EQ(emblib_swiss_set_size(&set), 56);
+    ASSERT_TRUE(emblib_swiss_set_is_empty(&set));
+
+    // less than one group
+    ASSERT_FALSE(emblib_swiss_set_init(&set, buffer, 15 * (sizeof(uint32_t) + 1), sizeof(uint32_t), u32_copy,
+                                       NULL, u32_cmp, u32_hash));
+}
+
+TEST(SwissSetTest, AddContainsRemove) {
+    emblib_swiss_set_t set;
+    uint8_t buffer[64 * (sizeof(uint32_t) + 1)];
+    emblib_swiss_set_init(&set, buffer, sizeof(buffer), sizeof(uint32_t), u32_copy, NULL, u32_cmp, u32_hash);
+
+    uint32_t elem = 42;
+    ASSERT_TRUE(emblib_swiss_set_add(&set, &elem));
+    ASSERT_FALSE(emblib_swiss_set_add(&set, &elem));
+    ASSERT_TRUE(emblib_swiss_set_contains(&set, &elem));
+    ASSERT_TRUE(emblib_swiss_set_remove(&set, &elem));
+    ASSERT_FALSE(emblib_swiss_set_contains(&set, &elem));
+    ASSERT_FALSE(emblib_swiss_set_remove(&set, &elem));
+    ASSERT_EQ(emblib_swiss_set_count(&set), 0);
+}
+
+TEST(SwissSetTest, FullSet) {
+    emblib_swiss_set_t set;
+    uint8_t buffer[32 * (sizeof(uint32_t) + 1)];
+    emblib_swiss_set_init(&set, buffer, sizeof(buffer), sizeof(uint32_t), u32_copy, NULL, u32_cmp, weak_hash);
+
+    uint32_t i = 0;
+    for (; i < emblib_swiss_set_size(&set); i++) {
+        ASSERT_TRUE(emblib_swiss_set_add(&set, &i));
+    }
+    ASSERT_TRUE(emblib_swiss_set_is_full(&set));
+    ASSERT_FALSE(emblib_swiss_set_add(&set, &i));
+    for (uint32_t j = 0; j < i; j++) {
+        ASSERT_TRUE(emblib_swiss_set_contains(&set, &j));
+    }
+
+    emblib_swiss_set_flush(&set);
+    ASSERT_TRUE(emblib_swiss_set_is_empty(&set));
+    ASSERT_FALSE(emblib_swiss_set_contains(&set, &i));
+}
+
+TEST(SwissSetTest, ChurnAgainstReference) {
+    emblib_swiss_set_t set;
+    std::vector<uint8_t> buffer(256 * (sizeof(uint32_t) + 1));
+    emblib_swiss_set_init(&set, buffer.data(), buffer.size(), sizeof(uint32_t), u32_copy, NULL, u32_cmp,
+                          u32_hash);
+
+    // keep the set close to full so deleted slots pile up and get cleaned in place
+    std::mt19937 rng(2024);
+    std::set<uint32_t> reference;
+    for (int i = 0; i < 200000; i++) {
+        uint32_t v = rng() % 1000;
+        if (reference.size() < 210 && (rng() & 1)) {
+            ASSERT_EQ(emblib_swiss_set_add(&set, &v), reference.insert(v).second);
+        } else {
+            ASSERT_EQ(emblib_swiss_set_remove(&set, &v), reference.erase(v) == 1);
+        }
+        ASSERT_EQ(emblib_swiss_set_count(&set), reference.size());
+    }
+    for (uint32_t v = 0; v < 1000; v++) {
+        ASSERT_EQ(emblib_swiss_set_contains(&set, &v), reference.count(v) == 1) << v;
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,142 @@
+extern "C" {
+#include "emblib_timer_wheel.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <random>
+#include <vector>
+
+typedef struct _expiry_t {
+    emblib_timer_wheel_t *wheel;
+    uint64_t expected;      //!< tick at which the timer must fire
+    uint64_t fired_at;      //!< tick at which it fired, 0 if not yet
+    int fired;              //!< number of times it fired
+} expiry_t;
+
+static void on_expiry(void *arg) {
+    expiry_t *expiry = (expiry_t *) arg;
+    expiry->fired_at = emblib_timer_wheel_now(expiry->wheel);
+    expiry->fired++;
+}
+
+class TimerWheelTest : public ::testing::Test {
+protected:
+    emblib_timer_wheel_t wheel;
+    std::vector<emblib_timer_t> timers = std::vector<emblib_timer_t>(512);
+
+    void SetUp() override {
+        ASSERT_TRUE(emblib_timer_wheel_init(&wheel, timers.data(), timers.size() * sizeof(emblib_timer_t)));
+    }
+
+    void run(uint64_t ticks) {
+        for (uint64_t i = 0; i < ticks; i++) {
+            emblib_timer_wheel_tick(&wheel);
+        }
+    }
+};
+
+TEST_F(TimerWheelTest, FiresOnTime) {
+    // one delay per level, around the level boundaries
+    const uint64_t delays[] = {1, 2, 63, 64, 65, 100, 4095, 4096, 4097, 70000, 300000};
+    std::vector<expiry_t> expiries;
+    for (uint64_t delay : delays) {
+        expiries.push_back({&wheel, delay, 0, 0});
+    }
+    for (auto &expiry : expiries) {
+        ASSERT_NE(emblib_timer_wheel_start(&wheel, expiry.expected, on_expiry, &expiry), EMBLIB_ILIST_NIL);
+    }
+    ASSERT_EQ(emblib_timer_wheel_count(&wheel), expiries.size());
+
+    run(300000);
+    for (auto &expiry : expiries) {
+        ASSERT_EQ(expiry.fired, 1) << expiry.expected;
+        ASSERT_EQ(expiry.fired_at, expiry.expected);
+    }
+    ASSERT_EQ(emblib_timer_wheel_count(&wheel), 0);
+}
+
+TEST_F(TimerWheelTest, BeyondRange) {
+    // more than 64^4 ticks: parked in the last level, then placed again
+    expiry_t expiry = {&wheel, ((uint64_t) 1 << 24) + 12345, 0, 0};
+    ASSERT_NE(emblib_timer_wheel_start(&wheel, expiry.expected, on_expiry, &expiry), EMBLIB_ILIST_NIL);
+    run(expiry.expected - 1);
+    ASSERT_EQ(expiry.fired, 0);
+    run(1);
+    ASSERT_EQ(expiry.fired, 1);
+    ASSERT_EQ(expiry.fired_at, expiry.expected);
+}
+
+TEST_F(TimerWheelTest, Cancel) {
+    expiry_t a = {&wheel, 10, 0, 0}, b = {&wheel, 5000, 0, 0};
+    emblib_ilist_index_t ha = emblib_timer_wheel_start(&wheel, 10, on_expiry, &a);
+    emblib_ilist_index_t hb = emblib_timer_wheel_start(&wheel, 5000, on_expiry, &b);
+
+    ASSERT_TRUE(emblib_timer_wheel_cancel(&wheel, hb));
+    ASSERT_FALSE(emblib_timer_wheel_cancel(&wheel, hb));
+    run(10);
+    ASSERT_EQ(a.fired, 1);
+    ASSERT_FALSE(emblib_timer_wheel_cancel(&wheel, ha));
+    run(5000);
+    ASSERT_EQ(b.fired, 0);
+    ASSERT_FALSE(emblib_timer_wheel_cancel(&wheel, EMBLIB_ILIST_NIL));
+}
+
+TEST_F(TimerWheelTest, RandomAgainstReference) {
+    std::mt19937 rng(9);
+    std::vector<expiry_t> expiries(2000);
+    std::vector<emblib_ilist_index_t> handles(expiries.size(), EMBLIB_ILIST_NIL);
+    std::vector<bool> cancelled(expiries.size(), false);
+
+    size_t next = 0;
+    for (uint64_t t = 0; t < 40000; t++) {
+        if (next < expiries.size() && rng() % 8 == 0) {
+            const uint64_t delay = 1 + rng() % (rng() % 2 ? 100 : 20000);
+            expiries[next] = {&wheel, emblib_timer_wheel_now(&wheel) + delay, 0, 0};
+            handles[next] = emblib_timer_wheel_start(&wheel, delay, on_expiry, &expiries[next]);
+            if (handles[next] == EMBLIB_ILIST_NIL) break;
+            next++;
+        }
+        if (next && rng() % 16 == 0) {
+            const size_t victim = rng() % next;
+            if (!expiries[victim].fired && !cancelled[victim]) {
+                ASSERT_TRUE(emblib_timer_wheel_cancel(&wheel, handles[victim]));
+                cancelled[victim] = true;
+            }
+        }
+        emblib_timer_wheel_tick(&wheel);
+    }
+    run(20000);
+
+    for (size_t i = 0; i < next; i++) {
+        if (cancelled[i]) {
+            ASSERT_EQ(expiries[i].fired, 0);
+        } else {
+            ASSERT_EQ(expiries[i].fired, 1) << i;
+            ASSERT_EQ(expiries[i].fired_at, expiries[i].expected) << i;
+        }
+    }
+    ASSERT_EQ(emblib_timer_wheel_count(&wheel), 0);
+}
+
+static void restart(void *arg) {
+    expiry_t *expiry = (expiry_t *) arg;
+    expiry->fired++;
+    if (expiry->fired < 5) {
+        emblib_timer_wheel_start(expiry->wheel, 100, restart, expiry);
+    }
+}
+
+TEST_F(TimerWheelTest, RestartFromCallback) {
+    expiry_t periodic = {&wheel, 0, 0, 0};
+    emblib_timer_wheel_start(&wheel, 100, restart, &periodic);
+    run(1000);
+    ASSERT_EQ(periodic.fired, 5);
+    ASSERT_EQ(emblib_timer_wheel_count(&wheel), 0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
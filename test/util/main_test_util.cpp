@@ -78,6 +78,24 @@ TEST(util_test, util_memrev_null) {
     ASSERT_EQ(ret, (void *) NULL);
 }
 
+TEST(util_test, util_popcount32) {
+    ASSERT_EQ(emblib_popcount32(0), 0);
+    ASSERT_EQ(emblib_popcount32(0xAA5555AA), 16);
+    ASSERT_EQ(emblib_popcount32(0xFFFFFFFF), 32);
+}
+
+TEST(util_test, util_ctz32_clz32) {
+    ASSERT_EQ(emblib_ctz32(0), 32);
+    ASSERT_EQ(emblib_ctz32(1), 0);
+    ASSERT_EQ(emblib_ctz32(0x80000000), 31);
+    ASSERT_EQ(emblib_ctz32(0x00A00000), 21);
+
+    ASSERT_EQ(emblib_clz32(0), 32);
+    ASSERT_EQ(emblib_clz32(1), 31);
+    ASSERT_EQ(emblib_clz32(0x80000000), 0);
+    ASSERT_EQ(emblib_clz32(0x00A00000), 8);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,142 @@
+extern "C" {
+#include "emblib_ws_deque.h"
+#include <inttypes.h>
+#include "emblib_util.h"
+}
+
+#include "gtest/gtest.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(WsDequeTest, Initialization) {
+    emblib_ws_deque_t deque;
+    int array[20];
+    ASSERT_TRUE(emblib_ws_deque_init(&deque, array, sizeof(array), sizeof(int)));
+    ASSERT_EQ(emblib_ws_deque_size(&deque), 16);
+    ASSERT_TRUE(emblib_ws_deque_is_empty(&deque));
+    ASSERT_FALSE(emblib_ws_deque_init(&deque, array, 2, sizeof(int)));
+    ASSERT_FALSE(emblib_ws_deque_init(&deque, NULL, sizeof(array), sizeof(int)));
+}
+
+TEST(WsDequeTest, OwnerLifoThiefFifo) {
+    emblib_ws_deque_t deque;
+    int array[8];
+    emblib_ws_deque_init(&deque, array, sizeof(array), sizeof(int));
+
+    for (int i = 0; i < 8; i++) {
+        ASSERT_TRUE(emblib_ws_deque_push(&deque, &i));
+    }
+    int value = 8;
+    ASSERT_FALSE(emblib_ws_deque_push(&deque, &value));
+    ASSERT_EQ(emblib_ws_deque_count(&deque), 8);
+
+    ASSERT_TRUE(emblib_ws_deque_pop(&deque, &value));
+    ASSERT_EQ(value, 7);
+    ASSERT_TRUE(emblib_ws_deque_steal(&deque, &value));
+    ASSERT_EQ(value, 0);
+    ASSERT_TRUE(emblib_ws_deque_steal(&deque, &value));
+    ASSERT_EQ(value, 1);
+
+    // wraps around the array
+    for (int i = 10; i < 13; i++) {
+        ASSERT_TRUE(emblib_ws_deque_push(&deque, &i));
+    }
+    const int expected[] = {12, 11, 10, 6, 5, 4, 3, 2};
+    for (int e : expected) {
+        ASSERT_TRUE(emblib_ws_deque_pop(&deque, &value));
+        ASSERT_EQ(value, e);
+    }
+    ASSERT_FALSE(emblib_ws_deque_pop(&deque, &value));
+    ASSERT_FALSE(emblib_ws_deque_steal(&deque, &value));
+    ASSERT_TRUE(emblib_ws_deque_is_empty(&deque));
+}
+
+TEST(WsDequeTest, ConcurrentSteal) {
+    // every pushed value is taken exactly once, by the owner or by a thief
+    const int total = 200000;
+    emblib_ws_deque_t deque;
+    std::vector<int> array(256);
+    emblib_ws_deque_init(&deque, array.data(), array.size() * sizeof(int), sizeof(int));
+
+    std::vector<std::atomic<int>> taken(total);
+    std::atomic<bool> done(false);
+    std::vector<std::thread> thieves;
+    for (int t = 0; t < 3; t++) {
+        thieves.emplace_back([&]() {
+            int value;
+            while (!done.load()) {
+                if (emblib_ws_deque_steal(&deque, &value)) taken[value]++;
+            }
+        });
+    }
+
+    int next = 0, value;
+    while (next < total) {
+        if (emblib_ws_deque_push(&deque, &next)) {
+            next++;
+        }
+        if (next % 3 == 0 && emblib_ws_deque_pop(&deque, &value)) {
+            taken[value]++;
+        }
+    }
+    while (emblib_ws_deque_pop(&deque, &value)) {
+        taken[value]++;
+    }
+    while (!emblib_ws_deque_is_empty(&deque)) {
+        std::this_thread::yield();
+    }
+    done.store(true);
+    for (auto &thief : thieves) {
+        thief.join();
+    }
+
+    for (int i = 0; i < total; i++) {
+        ASSERT_EQ(taken[i].load(), 1) << i;
+    }
+}
+
+TEST(WsDequeTest, LastElementRaceKeepsLoserBuffer) {
+    emblib_ws_deque_t deque;
+    int array[4];
+    ASSERT_TRUE(emblib_ws_deque_init(&deque, array, sizeof(array), sizeof(int)));
+
+    const int rounds = 100000;
+    std::atomic<bool> stop(false);
+    std::atomic<int> taken(0), clobbered(0);
+    std::thread thief([&]() {
+        while (!stop.load(std::memory_order_relaxed)) {
+            int value = -1;
+            if (emblib_ws_deque_steal(&deque, &value)) {
+                taken++;
+            } else if (value != -1) {
+                clobbered++;
+            }
+        }
+    });
+
+    // a single element at a time: every pop races the thief for the last element
+    for (int i = 0; i < rounds; i++) {
+        ASSERT_TRUE(emblib_ws_deque_push(&deque, &i));
+        int value = -1;
+        if (emblib_ws_deque_pop(&deque, &value)) {
+            ASSERT_EQ(value, i);
+            taken++;
+        } else {
+            ASSERT_EQ(value, -1);
+        }
+    }
+    while (taken.load() < rounds) {
+        std::this_thread::yield();
+    }
+    stop.store(true);
+    thief.join();
+
+    ASSERT_EQ(taken.load(), rounds);
+    ASSERT_EQ(clobbered.load(), 0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}